@@ -26,6 +26,8 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_input_distribution = params.getInputDistribution();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) +
@@ -59,7 +61,7 @@ REDUCE_SUM::~REDUCE_SUM()
 
 void REDUCE_SUM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitDataDistribution(m_x, getActualProblemSize(), m_input_distribution, vid);
   m_sum_init = 0.0;
   m_sum = 0.0;
 }
@@ -75,6 +75,8 @@ private:
   Real_ptr m_x;
   Real_type m_sum_init;
   Real_type m_sum;
+
+  InputDistributionID m_input_distribution;
 };
 
 } // end namespace algorithm
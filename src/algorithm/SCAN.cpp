@@ -26,6 +26,8 @@ SCAN::SCAN(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_input_distribution = params.getInputDistribution();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
@@ -63,7 +65,7 @@ SCAN::~SCAN()
 
 void SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  allocAndInitDataDistribution(m_x, getActualProblemSize(), m_input_distribution, vid);
   allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
 }
 
@@ -67,6 +67,8 @@ private:
 
   Real_ptr m_x;
   Real_ptr m_y;
+
+  InputDistributionID m_input_distribution;
 };
 
 } // end namespace algorithm
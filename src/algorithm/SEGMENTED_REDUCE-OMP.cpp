@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_REDUCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "SegmentUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SEGMENTED_REDUCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantLoadBalanced(vid);
+    return;
+
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  SEGMENTED_REDUCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          SEGMENTED_REDUCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto segmented_reduce_lam = [=](Index_type s) {
+                                    SEGMENTED_REDUCE_BODY;
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          segmented_reduce_lam(s);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_segments), [=](Index_type s) {
+          SEGMENTED_REDUCE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SEGMENTED_REDUCE::runOpenMPVariantLoadBalanced(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SEGMENTED_REDUCE_DATA_SETUP;
+
+  const Index_type nchunks = (iend - ibegin + load_balance_chunk_size - 1) /
+                             load_balance_chunk_size;
+  std::vector<Real_type> head_sums_vec(nchunks);
+  Real_ptr head_sums = head_sums_vec.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SEGMENTED_REDUCE_CHUNK_SETUP;
+          SEGMENTED_REDUCE_CHUNK_BODY;
+        }
+
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SEGMENTED_REDUCE_CHUNK_SETUP;
+          SEGMENTED_REDUCE_CHUNK_FIXUP;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+          SEGMENTED_REDUCE_CHUNK_SETUP;
+          SEGMENTED_REDUCE_CHUNK_BODY;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+          SEGMENTED_REDUCE_CHUNK_SETUP;
+          SEGMENTED_REDUCE_CHUNK_FIXUP;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SEGMENTED_REDUCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "load_balanced");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_REDUCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "SegmentUtils.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SEGMENTED_REDUCE::SEGMENTED_REDUCE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SEGMENTED_REDUCE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_mean_segment_length = params.getMeanSegmentLength();
+  m_segment_lengths = params.getSegmentLengths();
+
+  std::vector<Int_type> offsets;
+  host_segment::make_segment_offsets(offsets, getActualProblemSize(),
+                                     m_mean_segment_length, m_segment_lengths);
+  m_num_segments = offsets.size() - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_num_segments +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_num_segments+1) +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SEGMENTED_REDUCE::~SEGMENTED_REDUCE()
+{
+}
+
+void SEGMENTED_REDUCE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  std::vector<Int_type> offsets;
+  host_segment::make_segment_offsets(offsets, getActualProblemSize(),
+                                     m_mean_segment_length, m_segment_lengths);
+
+  allocData(m_offsets, m_num_segments+1);
+  std::copy(offsets.begin(), offsets.end(), m_offsets);
+
+  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, m_num_segments, 0.0, vid);
+}
+
+void SEGMENTED_REDUCE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_num_segments);
+}
+
+void SEGMENTED_REDUCE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_offsets);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SEGMENTED_REDUCE kernel reference implementation:
+///
+/// for (Index_type s = 0; s < num_segments; ++s ) {
+///   Real_type sum = 0.0;
+///   for (Index_type i = offsets[s]; i < offsets[s+1]; ++i ) {
+///     sum += x[i];
+///   }
+///   y[s] = sum;
+/// }
+///
+/// Segment lengths are set with --mean-segment-length and --segment-lengths.
+///
+/// The "load_balanced" tuning (Base/RAJA OpenMP) splits the elements into
+/// chunks of equal size so long segments are summed by several threads,
+/// see SegmentUtils.hpp.
+///
+
+#ifndef RAJAPerf_Algorithm_SEGMENTED_REDUCE_HPP
+#define RAJAPerf_Algorithm_SEGMENTED_REDUCE_HPP
+
+#define SEGMENTED_REDUCE_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr offsets = m_offsets; \
+  const Index_type num_segments = m_num_segments;
+
+#define SEGMENTED_REDUCE_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type i = offsets[s]; i < offsets[s+1]; ++i ) { \
+    sum += x[i]; \
+  } \
+  y[s] = sum;
+
+#define SEGMENTED_REDUCE_CHUNK_SETUP \
+  const Index_type cbegin = ibegin + c * load_balance_chunk_size; \
+  const Index_type cend = std::min(cbegin + load_balance_chunk_size, iend); \
+  const host_segment::chunk_range cr = \
+      host_segment::get_chunk_range(offsets, num_segments, cbegin, cend, iend);
+
+#define SEGMENTED_REDUCE_CHUNK_BODY \
+  Real_type head_sum = 0.0; \
+  for (Index_type i = cbegin; i < cr.head_end; ++i ) { \
+    head_sum += x[i]; \
+  } \
+  head_sums[c] = head_sum; \
+  for (Index_type s = cr.seg_begin; s < cr.seg_end; ++s ) { \
+    const Index_type send = std::min(static_cast<Index_type>(offsets[s+1]), cend); \
+    Real_type sum = 0.0; \
+    for (Index_type i = offsets[s]; i < send; ++i ) { \
+      sum += x[i]; \
+    } \
+    y[s] = sum; \
+  }
+
+#define SEGMENTED_REDUCE_CHUNK_FIXUP \
+  if ( cr.head_end > cbegin ) { \
+    y[cr.seg_begin-1] += head_sums[c]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SEGMENTED_REDUCE : public KernelBase
+{
+public:
+
+  SEGMENTED_REDUCE(const RunParams& params);
+
+  ~SEGMENTED_REDUCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_REDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_REDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_REDUCE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantLoadBalanced(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  static const Index_type load_balance_chunk_size = 4096;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_offsets;
+
+  Index_type m_mean_segment_length;
+  RunParams::SegmentLengths m_segment_lengths;
+  Index_type m_num_segments;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "SegmentUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SEGMENTED_SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantLoadBalanced(vid);
+    return;
+
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          SEGMENTED_SCAN_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto segmented_scan_lam = [=](Index_type s) {
+                                  SEGMENTED_SCAN_BODY;
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          segmented_scan_lam(s);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_segments), [=](Index_type s) {
+          SEGMENTED_SCAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SEGMENTED_SCAN::runOpenMPVariantLoadBalanced(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  const Index_type nchunks = (iend - ibegin + load_balance_chunk_size - 1) /
+                             load_balance_chunk_size;
+  std::vector<Index_type> head_ends_vec(nchunks);
+  std::vector<Real_type> tail_sums_vec(nchunks);
+  std::vector<Real_type> carries_vec(nchunks);
+  Index_type* head_ends = head_ends_vec.data();
+  Real_ptr tail_sums = tail_sums_vec.data();
+  Real_ptr carries = carries_vec.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SEGMENTED_SCAN_CHUNK_SETUP;
+          SEGMENTED_SCAN_CHUNK_BODY;
+        }
+
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SEGMENTED_SCAN_CHUNK_CARRY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type c = 0; c < nchunks; ++c ) {
+          SEGMENTED_SCAN_CHUNK_FIXUP;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+          SEGMENTED_SCAN_CHUNK_SETUP;
+          SEGMENTED_SCAN_CHUNK_BODY;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+          SEGMENTED_SCAN_CHUNK_CARRY;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+          SEGMENTED_SCAN_CHUNK_FIXUP;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SEGMENTED_SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "load_balanced");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SEGMENTED_SCAN kernel reference implementation:
+///
+/// // exclusive scan of each segment
+/// for (Index_type s = 0; s < num_segments; ++s ) {
+///   Real_type scan_var = 0.0;
+///   for (Index_type i = offsets[s]; i < offsets[s+1]; ++i ) {
+///     y[i] = scan_var;
+///     scan_var += x[i];
+///   }
+/// }
+///
+/// Segment lengths are set with --mean-segment-length and --segment-lengths.
+///
+/// The "load_balanced" tuning (Base/RAJA OpenMP) splits the elements into
+/// chunks of equal size so long segments are scanned by several threads,
+/// see SegmentUtils.hpp. The sums carried into each chunk are found in a
+/// sequential pass over the chunks and added to the chunk heads afterwards.
+///
+
+#ifndef RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+#define RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+
+#define SEGMENTED_SCAN_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr offsets = m_offsets; \
+  const Index_type num_segments = m_num_segments;
+
+#define SEGMENTED_SCAN_BODY \
+  Real_type scan_var = 0.0; \
+  for (Index_type i = offsets[s]; i < offsets[s+1]; ++i ) { \
+    y[i] = scan_var; \
+    scan_var += x[i]; \
+  }
+
+#define SEGMENTED_SCAN_CHUNK_SETUP \
+  const Index_type cbegin = ibegin + c * load_balance_chunk_size; \
+  const Index_type cend = std::min(cbegin + load_balance_chunk_size, iend); \
+  const host_segment::chunk_range cr = \
+      host_segment::get_chunk_range(offsets, num_segments, cbegin, cend, iend);
+
+#define SEGMENTED_SCAN_CHUNK_BODY \
+  Real_type scan_var = 0.0; \
+  for (Index_type i = cbegin; i < cr.head_end; ++i ) { \
+    y[i] = scan_var; \
+    scan_var += x[i]; \
+  } \
+  for (Index_type s = cr.seg_begin; s < cr.seg_end; ++s ) { \
+    const Index_type send = std::min(static_cast<Index_type>(offsets[s+1]), cend); \
+    scan_var = 0.0; \
+    for (Index_type i = offsets[s]; i < send; ++i ) { \
+      y[i] = scan_var; \
+      scan_var += x[i]; \
+    } \
+  } \
+  head_ends[c] = cr.head_end; \
+  tail_sums[c] = scan_var;
+
+#define SEGMENTED_SCAN_CHUNK_CARRY \
+  const Index_type cbegin = ibegin + c * load_balance_chunk_size; \
+  carries[c] = 0.0; \
+  if ( c > 0 && head_ends[c] > cbegin ) { \
+    carries[c] = tail_sums[c-1]; \
+    if ( head_ends[c-1] == cbegin ) { \
+      carries[c] += carries[c-1]; \
+    } \
+  }
+
+#define SEGMENTED_SCAN_CHUNK_FIXUP \
+  const Index_type cbegin = ibegin + c * load_balance_chunk_size; \
+  for (Index_type i = cbegin; i < head_ends[c]; ++i ) { \
+    y[i] += carries[c]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SEGMENTED_SCAN : public KernelBase
+{
+public:
+
+  SEGMENTED_SCAN(const RunParams& params);
+
+  ~SEGMENTED_SCAN();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantLoadBalanced(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  static const Index_type load_balance_chunk_size = 4096;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_offsets;
+
+  Index_type m_mean_segment_length;
+  RunParams::SegmentLengths m_segment_lengths;
+  Index_type m_num_segments;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
+#include <functional>
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +21,17 @@ namespace algorithm
 {
 
 
-void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantRadix(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -30,6 +40,23 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   switch ( vid ) {
 
+    case Base_OpenMP : {
+
+      host_sort::sample_workspace<Real_type> ws;
+      ws.resize(iend - ibegin, omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_sort::sample_sort_omp(x + iend*irep + ibegin, iend - ibegin, ws,
+                                   std::less<Real_type>{});
+
+      }
+      stopTimer();
+
+      break;
+    }
+
     case RAJA_OpenMP : {
 
       startTimer();
@@ -49,10 +76,60 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SORT::runOpenMPVariantRadix(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      host_sort::radix_workspace<Real_type, Real_type> ws;
+      ws.resize(iend - ibegin, omp_get_max_threads(), false);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_sort::radix_sort_omp(x + iend*irep + ibegin, static_cast<Real_ptr>(nullptr),
+                                  iend - ibegin, ws);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void SORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "radix");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,15 @@ namespace algorithm
 {
 
 
-void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+
+    runSeqVariantRadix(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -64,5 +73,49 @@ void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void SORT::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      host_sort::radix_workspace<Real_type, Real_type> ws;
+      ws.resize(iend - ibegin, 1, false);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_sort::radix_sort(x + iend*irep + ibegin, static_cast<Real_ptr>(nullptr),
+                              iend - ibegin, ws);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "radix");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -26,6 +26,8 @@ SORT::SORT(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_input_distribution = params.getInputDistribution();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
@@ -36,6 +38,7 @@ SORT::SORT(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -49,7 +52,7 @@ SORT::~SORT()
 
 void SORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  allocAndInitDataDistribution(m_x, getActualProblemSize()*getRunReps(), m_input_distribution, vid);
 }
 
 void SORT::updateChecksum(VariantID vid, size_t tune_idx)
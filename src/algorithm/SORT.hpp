@@ -11,6 +11,12 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// Tunings of the Base variants using the host sort engines in SortUtils.hpp:
+///
+///  "radix"   (Base Seq/OpenMP) LSD radix sort of the keys
+///
+/// The default tuning of Base_OpenMP is a parallel sample sort.
+///
 
 #ifndef RAJAPerf_Algorithm_SORT_HPP
 #define RAJAPerf_Algorithm_SORT_HPP
@@ -55,10 +61,17 @@ public:
     getCout() << "\n  SORT : Unknown OMP Target variant id = " << vid << std::endl;
   }
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runOpenMPVariantRadix(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 0;
 
   Real_ptr m_x;
+
+  InputDistributionID m_input_distribution;
 };
 
 } // end namespace algorithm
@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
+#include <utility>
+#include <vector>
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +22,17 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantRadix(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -30,6 +41,41 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
   switch ( vid ) {
 
+    case Base_OpenMP : {
+
+      using pair_type = std::pair<Real_type, Real_type>;
+
+      host_sort::sample_workspace<pair_type> ws;
+      ws.resize(iend - ibegin, omp_get_max_threads());
+
+      std::vector<pair_type> vector_of_pairs(iend - ibegin);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          vector_of_pairs[iemp - ibegin] = pair_type(x[iend*irep + iemp], i[iend*irep + iemp]);
+        }
+
+        host_sort::sample_sort_omp(vector_of_pairs.data(), iend - ibegin, ws,
+            [](pair_type const& lhs, pair_type const& rhs) {
+              return lhs.first < rhs.first;
+            });
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          pair_type& pair = vector_of_pairs[iemp - ibegin];
+          x[iend*irep + iemp] = pair.first;
+          i[iend*irep + iemp] = pair.second;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
     case RAJA_OpenMP : {
 
       startTimer();
@@ -49,10 +95,60 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariantRadix(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      host_sort::radix_workspace<Real_type, Real_type> ws;
+      ws.resize(iend - ibegin, omp_get_max_threads(), true);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_sort::radix_sort_omp(x + iend*irep + ibegin, i + iend*irep + ibegin,
+                                  iend - ibegin, ws);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void SORTPAIRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "radix");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <algorithm>
 #include <vector>
 #include <utility>
@@ -21,8 +23,15 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+
+    runSeqVariantRadix(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -84,5 +93,49 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void SORTPAIRS::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      host_sort::radix_workspace<Real_type, Real_type> ws;
+      ws.resize(iend - ibegin, 1, true);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_sort::radix_sort(x + iend*irep + ibegin, i + iend*irep + ibegin,
+                              iend - ibegin, ws);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORTPAIRS::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "radix");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
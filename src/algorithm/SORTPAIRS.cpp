@@ -26,6 +26,8 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_input_distribution = params.getInputDistribution();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (2*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
@@ -36,6 +38,7 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -49,8 +52,8 @@ SORTPAIRS::~SORTPAIRS()
 
 void SORTPAIRS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
-  allocAndInitDataRandValue(m_i, getActualProblemSize()*getRunReps(), vid);
+  allocAndInitDataDistribution(m_x, getActualProblemSize()*getRunReps(), m_input_distribution, vid);
+  allocAndInitDataDistribution(m_i, getActualProblemSize()*getRunReps(), m_input_distribution, vid);
 }
 
 void SORTPAIRS::updateChecksum(VariantID vid, size_t tune_idx)
@@ -11,6 +11,13 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// Tunings of the Base variants using the host sort engines in SortUtils.hpp:
+///
+///  "radix"   (Base Seq/OpenMP) LSD radix sort of the keys moving the
+///            values with them
+///
+/// The default tuning of Base_OpenMP is a parallel sample sort of pairs.
+///
 
 #ifndef RAJAPerf_Algorithm_SORTPAIRS_HPP
 #define RAJAPerf_Algorithm_SORTPAIRS_HPP
@@ -54,11 +61,18 @@ public:
     getCout() << "\n  SORTPAIRS : Unknown OMP Target variant id = " << vid << std::endl;
   }
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runOpenMPVariantRadix(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 0;
 
   Real_ptr m_x;
   Real_ptr m_i;
+
+  InputDistributionID m_input_distribution;
 };
 
 } // end namespace algorithm
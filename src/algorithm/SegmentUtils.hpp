@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Segment helpers used by the SEGMENTED_SCAN and SEGMENTED_REDUCE kernels.
+///
+/// Segments are described CSR style, segment s is [offsets[s], offsets[s+1]).
+///
+/// The load balanced tunings split the elements into fixed size chunks
+/// instead of assigning whole segments to threads. A chunk owns the
+/// segments that start in it and processes them up to the end of the chunk.
+/// The elements at the front of a chunk before its first owned segment, its
+/// head, belong to a segment owned by an earlier chunk and are combined with
+/// that segment in a later pass.
+///
+
+#ifndef RAJAPerf_Algorithm_SegmentUtils_HPP
+#define RAJAPerf_Algorithm_SegmentUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RunParams.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace host_segment
+{
+
+//
+// Make the offsets of segments covering [0, len) with lengths drawn from
+// the given distribution with the given mean.
+//
+inline void make_segment_offsets(std::vector<Int_type>& offsets,
+                                 Index_type len, Index_type mean_len,
+                                 RunParams::SegmentLengths lengths)
+{
+  offsets.clear();
+  offsets.push_back(0);
+
+  srand(4793);
+
+  Index_type pos = 0;
+  while ( pos < len ) {
+
+    Index_type seg_len = mean_len;
+
+    switch ( lengths ) {
+
+      case RunParams::SegmentLengths::Uniform : {
+        seg_len = rand() % (2*mean_len + 1);
+        break;
+      }
+
+      case RunParams::SegmentLengths::PowerLaw : {
+        // Pareto distribution with shape 1.5 and scale mean_len/3
+        Real_type u = (Real_type(rand()) + 1.0) / (Real_type(RAND_MAX) + 1.0);
+        seg_len = static_cast<Index_type>(
+                    (mean_len / 3.0) / std::pow(u, 1.0/1.5) );
+        seg_len = std::max(seg_len, static_cast<Index_type>(1));
+        break;
+      }
+
+      default : { }
+
+    }
+
+    pos += std::min(seg_len, len - pos);
+    offsets.push_back(static_cast<Int_type>(pos));
+  }
+}
+
+//
+// Segments [seg_begin, seg_end) start in a chunk, its head is
+// [chunk begin, head_end).
+//
+struct chunk_range
+{
+  Index_type seg_begin;
+  Index_type seg_end;
+  Index_type head_end;
+};
+
+inline chunk_range get_chunk_range(const Int_type* offsets,
+                                   Index_type num_segments,
+                                   Index_type cbegin, Index_type cend,
+                                   Index_type len)
+{
+  chunk_range cr;
+  cr.seg_begin = std::lower_bound(offsets, offsets + num_segments, cbegin)
+                 - offsets;
+  // empty segments at the end of the elements belong to the last chunk
+  cr.seg_end = (cend == len) ? num_segments
+             : std::lower_bound(offsets + cr.seg_begin, offsets + num_segments, cend)
+               - offsets;
+  cr.head_end = (cr.seg_begin < num_segments)
+              ? std::min(static_cast<Index_type>(offsets[cr.seg_begin]), cend)
+              : cend;
+  return cr;
+}
+
+} // end namespace host_segment
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
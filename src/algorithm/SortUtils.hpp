@@ -0,0 +1,387 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Host sort engines used by the SORT and SORTPAIRS Base variant tunings.
+///
+/// radix_sort   LSD radix sort of floating point keys, and optionally values,
+///              8 bits per pass. Keys are sorted as unsigned integers made
+///              from their bits so the integers order like the keys. Passes
+///              where every key has the same digit are skipped.
+///
+/// sample_sort  parallel sort by regular sampling, each thread sorts a block,
+///              splitters taken from samples of the sorted blocks divide the
+///              keys into one bucket per thread, and each thread merges the
+///              pieces of its bucket.
+///
+
+#ifndef RAJAPerf_Algorithm_SortUtils_HPP
+#define RAJAPerf_Algorithm_SortUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace host_sort
+{
+
+// unsigned integer type with the bits of the key type
+template < typename Key >
+struct radix_traits;
+///
+template < >
+struct radix_traits<double> { using uint_type = std::uint64_t; };
+///
+template < >
+struct radix_traits<float> { using uint_type = std::uint32_t; };
+
+constexpr int radix_bits = 8;
+constexpr int radix_size = 1 << radix_bits;
+
+// negative keys have all bits flipped, others have the sign bit set
+template < typename Key >
+inline typename radix_traits<Key>::uint_type to_radix(Key key)
+{
+  using uint_type = typename radix_traits<Key>::uint_type;
+  constexpr uint_type sign = uint_type(1) << (8*sizeof(uint_type) - 1);
+  uint_type bits;
+  std::memcpy(&bits, &key, sizeof(bits));
+  return (bits & sign) ? ~bits : (bits | sign);
+}
+
+template < typename Key >
+inline Key from_radix(typename radix_traits<Key>::uint_type bits)
+{
+  using uint_type = typename radix_traits<Key>::uint_type;
+  constexpr uint_type sign = uint_type(1) << (8*sizeof(uint_type) - 1);
+  bits = (bits & sign) ? (bits & ~sign) : ~bits;
+  Key key;
+  std::memcpy(&key, &bits, sizeof(key));
+  return key;
+}
+
+template < typename Key >
+inline int radix_digit(typename radix_traits<Key>::uint_type bits, int pass)
+{
+  return static_cast<int>((bits >> (pass * radix_bits)) & (radix_size - 1));
+}
+
+//
+// Buffers used by radix_sort, allocated once and reused by every sort.
+//
+template < typename Key, typename Value >
+struct radix_workspace
+{
+  using uint_type = typename radix_traits<Key>::uint_type;
+
+  static constexpr int num_passes = 8*sizeof(uint_type) / radix_bits;
+
+  void resize(Index_type len, int nthreads, bool with_values)
+  {
+    ukeys.resize(len);
+    ukeys_tmp.resize(len);
+    values_tmp.resize(with_values ? len : 0);
+    offsets.resize(nthreads * radix_size);
+  }
+
+  std::vector<uint_type> ukeys;
+  std::vector<uint_type> ukeys_tmp;
+  std::vector<Value> values_tmp;
+  std::vector<Index_type> offsets;
+  bool skip_pass;
+};
+
+//
+// Sort keys[0, len), and values[0, len) with them if values is not null.
+//
+template < typename Key, typename Value >
+inline void radix_sort(Key* keys, Value* values, Index_type len,
+                       radix_workspace<Key, Value>& ws)
+{
+  using uint_type = typename radix_traits<Key>::uint_type;
+  constexpr int num_passes = radix_workspace<Key, Value>::num_passes;
+
+  uint_type* src = ws.ukeys.data();
+  uint_type* dst = ws.ukeys_tmp.data();
+  Value* vsrc = values;
+  Value* vdst = ws.values_tmp.data();
+
+  Index_type counts[num_passes][radix_size] = { };
+
+  for (Index_type i = 0; i < len; ++i) {
+    src[i] = to_radix(keys[i]);
+    for (int pass = 0; pass < num_passes; ++pass) {
+      counts[pass][radix_digit<Key>(src[i], pass)] += 1;
+    }
+  }
+
+  for (int pass = 0; pass < num_passes; ++pass) {
+
+    Index_type* offsets = counts[pass];
+
+    Index_type offset = 0;
+    bool skip_pass = false;
+    for (int d = 0; d < radix_size; ++d) {
+      Index_type count = offsets[d];
+      skip_pass = skip_pass || (count == len);
+      offsets[d] = offset;
+      offset += count;
+    }
+    if (skip_pass) {
+      continue;
+    }
+
+    if (values) {
+      for (Index_type i = 0; i < len; ++i) {
+        Index_type pos = offsets[radix_digit<Key>(src[i], pass)]++;
+        dst[pos] = src[i];
+        vdst[pos] = vsrc[i];
+      }
+      std::swap(vsrc, vdst);
+    } else {
+      for (Index_type i = 0; i < len; ++i) {
+        dst[offsets[radix_digit<Key>(src[i], pass)]++] = src[i];
+      }
+    }
+    std::swap(src, dst);
+  }
+
+  for (Index_type i = 0; i < len; ++i) {
+    keys[i] = from_radix<Key>(src[i]);
+  }
+  if (values && vsrc != values) {
+    std::copy(vsrc, vsrc + len, values);
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Parallel radix_sort, each thread histograms and scatters its block of the
+// keys, the offsets of each digit are ordered by thread so the sort is stable.
+//
+template < typename Key, typename Value >
+inline void radix_sort_omp(Key* keys, Value* values, Index_type len,
+                           radix_workspace<Key, Value>& ws)
+{
+  using uint_type = typename radix_traits<Key>::uint_type;
+  constexpr int num_passes = radix_workspace<Key, Value>::num_passes;
+
+  if (len == 0) {
+    return;
+  }
+
+  const int p0 = static_cast<int>(std::min(len, static_cast<Index_type>(ws.offsets.size() / radix_size)));
+
+  #pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type step = len / p;
+    const Index_type local_begin = pid * step;
+    const Index_type local_end = (pid == p-1) ? len : (pid+1) * step;
+
+    uint_type* src = ws.ukeys.data();
+    uint_type* dst = ws.ukeys_tmp.data();
+    Value* vsrc = values;
+    Value* vdst = ws.values_tmp.data();
+
+    for (Index_type i = local_begin; i < local_end; ++i) {
+      src[i] = to_radix(keys[i]);
+    }
+
+    for (int pass = 0; pass < num_passes; ++pass) {
+
+      Index_type counts[radix_size] = { };
+      for (Index_type i = local_begin; i < local_end; ++i) {
+        counts[radix_digit<Key>(src[i], pass)] += 1;
+      }
+      for (int d = 0; d < radix_size; ++d) {
+        ws.offsets[pid * radix_size + d] = counts[d];
+      }
+
+      #pragma omp barrier
+
+      #pragma omp single
+      {
+        Index_type offset = 0;
+        ws.skip_pass = false;
+        for (int d = 0; d < radix_size; ++d) {
+          Index_type digit_begin = offset;
+          for (int ip = 0; ip < p; ++ip) {
+            Index_type count = ws.offsets[ip * radix_size + d];
+            ws.offsets[ip * radix_size + d] = offset;
+            offset += count;
+          }
+          ws.skip_pass = ws.skip_pass || (offset - digit_begin == len);
+        }
+      }
+
+      if (ws.skip_pass) {
+        continue;
+      }
+
+      Index_type* offsets = ws.offsets.data() + pid * radix_size;
+      if (values) {
+        for (Index_type i = local_begin; i < local_end; ++i) {
+          Index_type pos = offsets[radix_digit<Key>(src[i], pass)]++;
+          dst[pos] = src[i];
+          vdst[pos] = vsrc[i];
+        }
+        std::swap(vsrc, vdst);
+      } else {
+        for (Index_type i = local_begin; i < local_end; ++i) {
+          dst[offsets[radix_digit<Key>(src[i], pass)]++] = src[i];
+        }
+      }
+      std::swap(src, dst);
+
+      #pragma omp barrier
+    }
+
+    for (Index_type i = local_begin; i < local_end; ++i) {
+      keys[i] = from_radix<Key>(src[i]);
+    }
+    if (values && vsrc != values) {
+      std::copy(vsrc + local_begin, vsrc + local_end, values + local_begin);
+    }
+  }
+}
+
+//
+// Buffers used by sample_sort_omp, allocated once and reused by every sort.
+//
+template < typename T >
+struct sample_workspace
+{
+  void resize(Index_type len, int nthreads)
+  {
+    tmp.resize(len);
+    samples.resize(nthreads * nthreads);
+    bounds.resize(nthreads * (nthreads + 1));
+    bucket_begin.resize(nthreads + 1);
+    pieces.resize(nthreads * (nthreads + 1));
+  }
+
+  std::vector<T> tmp;
+  std::vector<T> samples;
+  std::vector<Index_type> bounds;
+  std::vector<Index_type> bucket_begin;
+  std::vector<Index_type> pieces;
+};
+
+//
+// Sort data[0, len) with comp.
+//
+template < typename T, typename Compare >
+inline void sample_sort_omp(T* data, Index_type len,
+                            sample_workspace<T>& ws, Compare comp)
+{
+  if (len == 0) {
+    return;
+  }
+
+  const int p0 = static_cast<int>(std::min(len, static_cast<Index_type>(ws.bucket_begin.size() - 1)));
+
+  #pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type step = len / p;
+    const Index_type local_begin = pid * step;
+    const Index_type local_end = (pid == p-1) ? len : (pid+1) * step;
+    const Index_type local_len = local_end - local_begin;
+
+    std::sort(data + local_begin, data + local_end, comp);
+
+    for (int k = 0; k < p; ++k) {
+      ws.samples[pid * p + k] = data[local_begin + local_len * k / p];
+    }
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      std::sort(ws.samples.begin(), ws.samples.begin() + p * p, comp);
+    }
+
+    // bucket j of this block is [bounds[j], bounds[j+1]), bucket j holds
+    // the keys not less than splitter j-1 and less than splitter j
+    Index_type* bounds = ws.bounds.data() + pid * (p + 1);
+    bounds[0] = local_begin;
+    for (int j = 1; j < p; ++j) {
+      bounds[j] = std::lower_bound(data + bounds[j-1], data + local_end,
+                                   ws.samples[j * p], comp) - data;
+    }
+    bounds[p] = local_end;
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      ws.bucket_begin[0] = 0;
+      for (int j = 0; j < p; ++j) {
+        Index_type bucket_len = 0;
+        for (int ip = 0; ip < p; ++ip) {
+          bucket_len += ws.bounds[ip * (p + 1) + j + 1] - ws.bounds[ip * (p + 1) + j];
+        }
+        ws.bucket_begin[j + 1] = ws.bucket_begin[j] + bucket_len;
+      }
+    }
+
+    // gather the sorted pieces of this thread's bucket, piece ip of the
+    // bucket is [piece[ip], piece[ip+1])
+    T* bucket = ws.tmp.data() + ws.bucket_begin[pid];
+    Index_type* piece = ws.pieces.data() + pid * (p + 1);
+    T* out = bucket;
+    piece[0] = 0;
+    for (int ip = 0; ip < p; ++ip) {
+      const Index_type* ibounds = ws.bounds.data() + ip * (p + 1);
+      out = std::copy(data + ibounds[pid], data + ibounds[pid + 1], out);
+      piece[ip + 1] = out - bucket;
+    }
+
+    #pragma omp barrier
+
+    // merge pairs of pieces back and forth between the bucket and the same
+    // range of data, which no thread reads after the barrier
+    T* src = bucket;
+    T* dst = data + ws.bucket_begin[pid];
+    for (int width = 1; width < p; width *= 2) {
+      for (int ip = 0; ip < p; ip += 2 * width) {
+        const Index_type mid = piece[std::min(ip + width, p)];
+        const Index_type end = piece[std::min(ip + 2 * width, p)];
+        std::merge(src + piece[ip], src + mid, src + mid, src + end,
+                   dst + piece[ip], comp);
+      }
+      std::swap(src, dst);
+    }
+
+    if (src == bucket) {
+      std::copy(bucket, bucket + piece[p], data + ws.bucket_begin[pid]);
+    }
+  }
+}
+
+#endif
+
+} // end namespace host_sort
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
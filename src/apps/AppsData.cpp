@@ -9,6 +9,8 @@
 #include "common/RAJAPerfSuite.hpp"
 #include "AppsData.hpp"
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 
 namespace rajaperf
@@ -110,5 +112,313 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
   }
 }
 
+//
+// Tuning name of the unstructured mesh tunings using the given ordering.
+//
+std::string getMeshOrderingTuningName(MeshOrdering ordering)
+{
+  switch ( ordering ) {
+    case MeshOrdering::Lexicographic : return "unstructured";
+    case MeshOrdering::Random : return "unstructured_random";
+    case MeshOrdering::Morton : return "unstructured_morton";
+    case MeshOrdering::Hilbert : return "unstructured_hilbert";
+    case MeshOrdering::RCM : return "unstructured_rcm";
+    default : break;
+  }
+  return "unstructured_unknown";
+}
+
+//
+// Interleave the bits of the zone coordinates, i fastest.
+//
+static unsigned long long mortonCode(Index_type i, Index_type j, Index_type k)
+{
+  unsigned long long code = 0;
+  for (int b = 0; b < 21; ++b) {
+    code |= ((static_cast<unsigned long long>(i) >> b) & 1ull) << (3*b + 0);
+    code |= ((static_cast<unsigned long long>(j) >> b) & 1ull) << (3*b + 1);
+    code |= ((static_cast<unsigned long long>(k) >> b) & 1ull) << (3*b + 2);
+  }
+  return code;
+}
+
+//
+// Distance along the Hilbert curve through a 2^bits sized 2d/3d grid of the
+// point (i,j,k), using the transpose form of J. Skilling, "Programming the
+// Hilbert curve", AIP Conf. Proc. 707 (2004).
+//
+static unsigned long long hilbertCode(Index_type i, Index_type j, Index_type k,
+                                      int ndims, int bits)
+{
+  unsigned long long X[3] = { static_cast<unsigned long long>(i),
+                              static_cast<unsigned long long>(j),
+                              static_cast<unsigned long long>(k) };
+  const unsigned long long M = 1ull << (bits - 1);
+
+  // inverse undo of the excess work
+  for (unsigned long long Q = M; Q > 1; Q >>= 1) {
+    const unsigned long long P = Q - 1;
+    for (int d = 0; d < ndims; ++d) {
+      if ( X[d] & Q ) {
+        X[0] ^= P;
+      } else {
+        const unsigned long long t = (X[0] ^ X[d]) & P;
+        X[0] ^= t;
+        X[d] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int d = 1; d < ndims; ++d) {
+    X[d] ^= X[d-1];
+  }
+  unsigned long long t = 0;
+  for (unsigned long long Q = M; Q > 1; Q >>= 1) {
+    if ( X[ndims-1] & Q ) t ^= Q - 1;
+  }
+  for (int d = 0; d < ndims; ++d) {
+    X[d] ^= t;
+  }
+
+  // interleave the transposed bits, most significant first
+  unsigned long long code = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    for (int d = 0; d < ndims; ++d) {
+      code = (code << 1) | ((X[d] >> b) & 1ull);
+    }
+  }
+  return code;
+}
+
+//
+// Random permutation of v, same sequence for every run.
+//
+void randomShuffle(std::vector<Index_type>& v)
+{
+  srand(4793);
+  for (Index_type n = static_cast<Index_type>(v.size()); n > 1; --n) {
+    Index_type r = static_cast<Index_type>(
+        (static_cast<unsigned long long>(rand()) * RAND_MAX + rand()) % n);
+    std::swap(v[n-1], v[r]);
+  }
+}
+
+//
+// Reverse Cuthill-McKee order of the zones, zones are adjacent when they
+// share a node.
+//
+static void setRCMZoneOrder(std::vector<Index_type>& order,
+                            const std::vector<Index_type>& zone_nodes,
+                            Index_type nodes_per_zone,
+                            Index_type nzones, Index_type nnodes)
+{
+  // zones of each node
+  std::vector<Index_type> node_zones_ptr(nnodes+1, 0);
+  for (Index_type zn = 0; zn < nzones*nodes_per_zone; ++zn) {
+    node_zones_ptr[zone_nodes[zn]+1]++;
+  }
+  for (Index_type n = 0; n < nnodes; ++n) {
+    node_zones_ptr[n+1] += node_zones_ptr[n];
+  }
+  std::vector<Index_type> node_zones(node_zones_ptr[nnodes]);
+  {
+    std::vector<Index_type> pos(node_zones_ptr.begin(), node_zones_ptr.end()-1);
+    for (Index_type z = 0; z < nzones; ++z) {
+      for (Index_type c = 0; c < nodes_per_zone; ++c) {
+        node_zones[pos[zone_nodes[z*nodes_per_zone + c]]++] = z;
+      }
+    }
+  }
+
+  auto for_each_neighbor = [&](Index_type z, auto&& body) {
+    for (Index_type c = 0; c < nodes_per_zone; ++c) {
+      const Index_type n = zone_nodes[z*nodes_per_zone + c];
+      for (Index_type nz = node_zones_ptr[n]; nz < node_zones_ptr[n+1]; ++nz) {
+        if (node_zones[nz] != z) body(node_zones[nz]);
+      }
+    }
+  };
+
+  std::vector<Index_type> degree(nzones, 0);
+  {
+    std::vector<Index_type> stamp(nzones, -1);
+    for (Index_type z = 0; z < nzones; ++z) {
+      for_each_neighbor(z, [&](Index_type nbr) {
+        if (stamp[nbr] != z) {
+          stamp[nbr] = z;
+          degree[z]++;
+        }
+      });
+    }
+  }
+
+  // start each connected component at a zone of minimum degree
+  std::vector<Index_type> starts(nzones);
+  for (Index_type z = 0; z < nzones; ++z) starts[z] = z;
+  std::stable_sort(starts.begin(), starts.end(),
+                   [&](Index_type a, Index_type b) { return degree[a] < degree[b]; });
+
+  std::vector<bool> visited(nzones, false);
+  std::vector<Index_type> nbrs;
+  order.clear();
+  order.reserve(nzones);
+  for (Index_type s : starts) {
+    if (visited[s]) continue;
+    visited[s] = true;
+    // breadth first search using order as the queue
+    order.push_back(s);
+    for (size_t q = order.size() - 1; q < order.size(); ++q) {
+      nbrs.clear();
+      for_each_neighbor(order[q], [&](Index_type nbr) {
+        if (!visited[nbr]) {
+          visited[nbr] = true;
+          nbrs.push_back(nbr);
+        }
+      });
+      std::stable_sort(nbrs.begin(), nbrs.end(),
+                       [&](Index_type a, Index_type b) { return degree[a] < degree[b]; });
+      order.insert(order.end(), nbrs.begin(), nbrs.end());
+    }
+  }
+  std::reverse(order.begin(), order.end());
+}
+
+//
+// Order indices along a Morton or Hilbert space-filling curve.
+//
+void setSpaceFillingCurveOrder(std::vector<Index_type>& order,
+                               const Index_type* indices, Index_type n,
+                               Index_type jp, Index_type kp,
+                               MeshOrdering ordering)
+{
+  const int ndims = (kp > 0) ? 3 : 2;
+
+  auto ijk = [&](Index_type idx, Index_type& i, Index_type& j, Index_type& k) {
+    k = (kp > 0) ? idx / kp : 0;
+    j = (idx - k*kp) / jp;
+    i = idx - k*kp - j*jp;
+  };
+
+  // bits needed for the largest coordinate
+  int bits = 1;
+  for (Index_type s = 0; s < n; ++s) {
+    Index_type i, j, k;
+    ijk(indices[s], i, j, k);
+    while ( (std::max(i, std::max(j, k)) >> bits) > 0 ) ++bits;
+  }
+
+  std::vector<std::pair<unsigned long long, Index_type>> codes(n);
+  for (Index_type s = 0; s < n; ++s) {
+    Index_type i, j, k;
+    ijk(indices[s], i, j, k);
+    codes[s].first = (ordering == MeshOrdering::Hilbert)
+                       ? hilbertCode(i, j, k, ndims, bits)
+                       : mortonCode(i, j, k);
+    codes[s].second = indices[s];
+  }
+  std::stable_sort(codes.begin(), codes.end(),
+                   [](const std::pair<unsigned long long, Index_type>& a,
+                      const std::pair<unsigned long long, Index_type>& b) {
+                     return a.first < b.first;
+                   });
+
+  order.resize(n);
+  for (Index_type s = 0; s < n; ++s) {
+    order[s] = codes[s].second;
+  }
+}
+
+
+//
+// Build unstructured mesh for the given zones of a 2d/3d domain.
+//
+void setUnstructuredMesh(UnstructuredMesh& mesh,
+                         const Index_type* zones, Index_type nzones,
+                         const ADomain& domain,
+                         MeshOrdering ordering)
+{
+  const Index_type jp = domain.jp;
+  const Index_type kp = domain.kp;
+
+  std::vector<Index_type> corners;
+  if ( domain.ndims == 2 ) {
+    corners = { 1, 1 + jp, jp, 0 };
+  } else {
+    corners = { 0, 1, jp, 1 + jp, kp, 1 + kp, jp + kp, 1 + jp + kp };
+  }
+  const Index_type nodes_per_zone = corners.size();
+  mesh.nodes_per_zone = nodes_per_zone;
+
+  //
+  // Order the zones.
+  //
+  mesh.zone_order.assign(zones, zones + nzones);
+
+  if ( ordering == MeshOrdering::Random ) {
+
+    randomShuffle(mesh.zone_order);
+
+  } else if ( ordering == MeshOrdering::Morton ||
+              ordering == MeshOrdering::Hilbert ) {
+
+    setSpaceFillingCurveOrder(mesh.zone_order, zones, nzones, jp, kp, ordering);
+
+  }
+
+  //
+  // Number the nodes as first touched by the zones.
+  //
+  std::vector<Index_type> node_id(domain.nnalls);
+  mesh.zone_nodes.resize(nzones*nodes_per_zone);
+
+  auto number_nodes = [&]() {
+    std::fill(node_id.begin(), node_id.end(), -1);
+    mesh.node_order.clear();
+    for (Index_type z = 0; z < nzones; ++z) {
+      for (Index_type c = 0; c < nodes_per_zone; ++c) {
+        const Index_type in = mesh.zone_order[z] + corners[c];
+        if ( node_id[in] < 0 ) {
+          node_id[in] = mesh.node_order.size();
+          mesh.node_order.push_back(in);
+        }
+        mesh.zone_nodes[z*nodes_per_zone + c] = node_id[in];
+      }
+    }
+  };
+
+  number_nodes();
+  const Index_type nnodes = mesh.node_order.size();
+
+  if ( ordering == MeshOrdering::RCM ) {
+
+    std::vector<Index_type> rcm;
+    setRCMZoneOrder(rcm, mesh.zone_nodes, nodes_per_zone, nzones, nnodes);
+
+    std::vector<Index_type> zone_order(nzones);
+    for (Index_type z = 0; z < nzones; ++z) {
+      zone_order[z] = mesh.zone_order[rcm[z]];
+    }
+    mesh.zone_order.swap(zone_order);
+
+    // renumber the nodes as first touched in the new zone order
+    number_nodes();
+
+  } else if ( ordering == MeshOrdering::Random ) {
+
+    randomShuffle(mesh.node_order);
+    for (Index_type n = 0; n < nnodes; ++n) {
+      node_id[mesh.node_order[n]] = n;
+    }
+    for (Index_type z = 0; z < nzones; ++z) {
+      for (Index_type c = 0; c < nodes_per_zone; ++c) {
+        mesh.zone_nodes[z*nodes_per_zone + c] =
+            node_id[mesh.zone_order[z] + corners[c]];
+      }
+    }
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
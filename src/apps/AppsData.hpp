@@ -11,6 +11,9 @@
 
 #include "common/RPTypes.hpp"
 
+#include <string>
+#include <vector>
+
 namespace rajaperf
 {
 namespace apps
@@ -155,6 +158,65 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
                          Real_ptr z, Real_type dz,
                          const ADomain& domain);
 
+//
+// Numbering of the zones and nodes of an unstructured mesh.
+//
+enum struct MeshOrdering
+{
+  Lexicographic,  // zones in (i,j,k) order, nodes numbered as first touched
+  Random,         // zones and nodes in random order
+  Morton,         // zones in Morton (Z-curve) order, nodes as first touched
+  Hilbert,        // zones in Hilbert curve order, nodes as first touched
+  RCM,            // zones in reverse Cuthill-McKee order, nodes as first touched
+
+  NumMeshOrderings
+};
+
+//
+// Tuning name of the unstructured mesh tunings using the given ordering.
+//
+std::string getMeshOrderingTuningName(MeshOrdering ordering);
+
+//
+// Zones of a 2d/3d domain stored as an unstructured mesh with an explicit
+// zone to node connectivity.
+//
+// Zone z of the mesh is zone zone_order[z] of the domain and node n of the
+// mesh is node node_order[n] of the domain, both are indices into the
+// domain arrays. The nodes of zone z are zone_nodes[nodes_per_zone*z + c]
+// with corners c in the order of NDSET2D (v1,v2,v3,v4) or NDPTRSET (v0..v7).
+//
+struct UnstructuredMesh
+{
+  Index_type nodes_per_zone;
+  std::vector<Index_type> zone_order;
+  std::vector<Index_type> node_order;
+  std::vector<Index_type> zone_nodes;
+};
+
+//
+// Random permutation of v, same sequence for every run.
+//
+void randomShuffle(std::vector<Index_type>& v);
+
+//
+// Order n indices into a 2d/3d array with strides jp and kp (kp is 0 in 2d)
+// along the Morton or Hilbert space-filling curve through their (i,j,k)
+// positions, order[s] is the index at position s along the curve.
+//
+void setSpaceFillingCurveOrder(std::vector<Index_type>& order,
+                               const Index_type* indices, Index_type n,
+                               Index_type jp, Index_type kp,
+                               MeshOrdering ordering);
+
+//
+// Build the unstructured mesh of the given domain zones.
+//
+void setUnstructuredMesh(UnstructuredMesh& mesh,
+                         const Index_type* zones, Index_type nzones,
+                         const ADomain& domain,
+                         MeshOrdering ordering);
+
 } // end namespace apps
 } // end namespace rajaperf
 
@@ -15,7 +15,8 @@
 namespace rajaperf {
 namespace apps {
 
-void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void CONVECTION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,88 +35,88 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
         CONVECTION3DPA_0_CPU;
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_1;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_2;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(qx,x,CPA_Q1D)
+          CPU_FOREACH(qx,x,Q1D)
           {
-            CPU_FOREACH(qy,y,CPA_Q1D)
+            CPU_FOREACH(qy,y,Q1D)
             {
               CONVECTION3DPA_3;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qz,z,CPA_Q1D)
+            CPU_FOREACH(qz,z,Q1D)
             {
               CONVECTION3DPA_4;
             }
           }
         }
 
-        CPU_FOREACH(qz,z,CPA_Q1D)
+        CPU_FOREACH(qz,z,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_5;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(dz,z,CPA_D1D)
+            CPU_FOREACH(dz,z,D1D)
             {
               CONVECTION3DPA_6;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-           CPU_FOREACH(qx,x,CPA_Q1D)
+           CPU_FOREACH(qx,x,Q1D)
            {
-              CPU_FOREACH(dy,y,CPA_D1D)
+              CPU_FOREACH(dy,y,D1D)
               {
                 CONVECTION3DPA_7;
              }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_8;
             }
@@ -154,11 +155,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
              CONVECTION3DPA_0_CPU;
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_1;
@@ -172,11 +173,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_2;
@@ -190,11 +191,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qy) {
 
                           CONVECTION3DPA_3;
@@ -208,11 +209,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qz) {
 
                           CONVECTION3DPA_4;
@@ -226,11 +227,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_5;
@@ -244,11 +245,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dz) {
 
                           CONVECTION3DPA_6;
@@ -262,11 +263,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dy) {
 
                           CONVECTION3DPA_7;
@@ -280,11 +281,11 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_8;
@@ -317,5 +318,83 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+template < int D1D, int Q1D >
+void CONVECTION3DPA::runOpenMPVariantSimdImpl(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  CONVECTION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        CONVECTION3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  case RAJA_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        CONVECTION3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n CONVECTION3DPA : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runOpenMPVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runOpenMPVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void CONVECTION3DPA::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
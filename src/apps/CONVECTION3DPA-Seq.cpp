@@ -15,7 +15,8 @@
 namespace rajaperf {
 namespace apps {
 
-void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void CONVECTION3DPA::runSeqVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   CONVECTION3DPA_DATA_SETUP;
@@ -31,88 +32,88 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
         CONVECTION3DPA_0_CPU;
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_1;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_2;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(qx,x,CPA_Q1D)
+          CPU_FOREACH(qx,x,Q1D)
           {
-            CPU_FOREACH(qy,y,CPA_Q1D)
+            CPU_FOREACH(qy,y,Q1D)
             {
               CONVECTION3DPA_3;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qz,z,CPA_Q1D)
+            CPU_FOREACH(qz,z,Q1D)
             {
               CONVECTION3DPA_4;
             }
           }
         }
 
-        CPU_FOREACH(qz,z,CPA_Q1D)
+        CPU_FOREACH(qz,z,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qx,x,Q1D)
             {
               CONVECTION3DPA_5;
             }
           }
         }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
+        CPU_FOREACH(qx,x,Q1D)
         {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qy,y,Q1D)
           {
-            CPU_FOREACH(dz,z,CPA_D1D)
+            CPU_FOREACH(dz,z,D1D)
             {
               CONVECTION3DPA_6;
             }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-           CPU_FOREACH(qx,x,CPA_Q1D)
+           CPU_FOREACH(qx,x,Q1D)
            {
-              CPU_FOREACH(dy,y,CPA_D1D)
+              CPU_FOREACH(dy,y,D1D)
               {
                 CONVECTION3DPA_7;
              }
           }
         }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
+        CPU_FOREACH(dz,z,D1D)
         {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dy,y,D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dx,x,D1D)
             {
               CONVECTION3DPA_8;
             }
@@ -152,11 +153,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
              CONVECTION3DPA_0_CPU;
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_1;
@@ -170,11 +171,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_2;
@@ -188,11 +189,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qy) {
 
                           CONVECTION3DPA_3;
@@ -206,11 +207,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qz) {
 
                           CONVECTION3DPA_4;
@@ -224,11 +225,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           CONVECTION3DPA_5;
@@ -242,11 +243,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+              RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qx) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dz) {
 
                           CONVECTION3DPA_6;
@@ -260,11 +261,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
-                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dy) {
 
                           CONVECTION3DPA_7;
@@ -278,11 +279,11 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
             ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, CPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           CONVECTION3DPA_8;
@@ -312,5 +313,76 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   }
 }
 
+template < int D1D, int Q1D >
+void CONVECTION3DPA::runSeqVariantSimdImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  CONVECTION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        CONVECTION3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+#if defined(RUN_RAJA_SEQ)
+  case RAJA_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::loop_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        CONVECTION3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+#endif // RUN_RAJA_SEQ
+
+  default:
+    getCout() << "\n CONVECTION3DPA : Unknown Seq variant id = " << vid << std::endl;
+  }
+}
+
+void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runSeqVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runSeqVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void CONVECTION3DPA::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -25,29 +25,36 @@ CONVECTION3DPA::CONVECTION3DPA(const RunParams& params)
 {
   m_NE_default = 15625;
 
+  m_D1D = CPA_D1D;
+  m_Q1D = CPA_Q1D;
+  if ( params.getPAOrder() > 0 ) {
+    m_D1D = params.getPAOrder() + 1;
+    m_Q1D = params.getPAOrder() + 2;
+  }
+
   setDefaultProblemSize(m_NE_default*CPA_Q1D*CPA_Q1D*CPA_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(CPA_Q1D*CPA_Q1D*CPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*CPA_Q1D*CPA_Q1D*CPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 3*CPA_Q1D*CPA_D1D*sizeof(Real_type)  +
-                  CPA_VDIM*CPA_Q1D*CPA_Q1D*CPA_Q1D*m_NE*sizeof(Real_type) +
-                  CPA_D1D*CPA_D1D*CPA_D1D*m_NE*sizeof(Real_type) +
-                  CPA_D1D*CPA_D1D*CPA_D1D*m_NE*sizeof(Real_type) );
+  setBytesPerRep( 3*m_Q1D*m_D1D*sizeof(Real_type)  +
+                  CPA_VDIM*m_Q1D*m_Q1D*m_Q1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) );
 
   setFLOPsPerRep(m_NE * (
-                         4 * CPA_D1D * CPA_Q1D * CPA_D1D * CPA_D1D + //2
-                         6 * CPA_D1D * CPA_Q1D * CPA_Q1D * CPA_D1D + //3
-                         6 * CPA_D1D * CPA_Q1D * CPA_Q1D * CPA_Q1D + //4
-                         5 * CPA_Q1D * CPA_Q1D * CPA_Q1D +  // 5
-                         2 * CPA_Q1D * CPA_D1D * CPA_Q1D * CPA_Q1D + // 6
-                         2 * CPA_Q1D * CPA_D1D * CPA_Q1D * CPA_D1D + // 7
-                         (1 + 2*CPA_Q1D) * CPA_D1D * CPA_D1D * CPA_D1D // 8
+                         4 * m_D1D * m_Q1D * m_D1D * m_D1D + //2
+                         6 * m_D1D * m_Q1D * m_Q1D * m_D1D + //3
+                         6 * m_D1D * m_Q1D * m_Q1D * m_Q1D + //4
+                         5 * m_Q1D * m_Q1D * m_Q1D +  // 5
+                         2 * m_Q1D * m_D1D * m_Q1D * m_Q1D + // 6
+                         2 * m_Q1D * m_D1D * m_Q1D * m_D1D + // 7
+                         (1 + 2*m_Q1D) * m_D1D * m_D1D * m_D1D // 8
                          ));
 
   setUsesFeature(Teams);
@@ -58,11 +65,16 @@ CONVECTION3DPA::CONVECTION3DPA(const RunParams& params)
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // GPU variants are only compiled for the default order
+  if ( m_D1D == CPA_D1D && m_Q1D == CPA_Q1D ) {
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
+
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+  }
 
 }
 
@@ -73,17 +85,17 @@ CONVECTION3DPA::~CONVECTION3DPA()
 void CONVECTION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 
-  allocAndInitDataConst(m_B,  int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt, int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(CPA_Q1D*CPA_Q1D*CPA_Q1D*CPA_VDIM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(CPA_D1D*CPA_D1D*CPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(CPA_D1D*CPA_D1D*CPA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B,  int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*CPA_VDIM*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void CONVECTION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, CPA_D1D*CPA_D1D*CPA_D1D*m_NE);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void CONVECTION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -190,6 +190,15 @@
 ///   }
 /// } // element loop
 ///
+/// The default order has CPA_D1D dofs and CPA_Q1D quadrature points in 1D.
+/// The host variants are templated on (D1D, Q1D) and also run the order
+/// set with --pa-order, order p has D1D = p+1 and Q1D = p+2.
+///
+/// The "simd_elements" tuning of the Base and RAJA host variants runs
+/// batches of RAJAPERF_PA_SIMD_WIDTH elements, the batch is the fastest
+/// index of the intermediate arrays so each contraction vectorizes across
+/// the elements of the batch.
+///
 
 #ifndef RAJAPerf_Apps_CONVECTION3DPA_HPP
 #define RAJAPerf_Apps_CONVECTION3DPA_HPP
@@ -208,19 +217,20 @@ Index_type NE = m_NE;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
+//Number of Dofs/Qpts in 1D of the default order, GPU variants only run
+//this order, host variants run any order in RAJAPERF_PA_ORDERS
 #define CPA_D1D 3
 #define CPA_Q1D 4
 #define CPA_VDIM 3
-#define cpa_B(x, y) Basis[x + CPA_Q1D * y]
-#define cpa_Bt(x, y) tBasis[x + CPA_D1D * y]
-#define cpa_G(x, y) dBasis[x + CPA_Q1D * y]
+#define cpa_B(x, y) Basis[x + max_Q1D * y]
+#define cpa_Bt(x, y) tBasis[x + max_D1D * y]
+#define cpa_G(x, y) dBasis[x + max_Q1D * y]
 #define cpaX_(dx, dy, dz, e)                                                     \
-  X[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  X[dx + max_D1D * dy + max_D1D * max_D1D * dz + max_D1D * max_D1D * max_D1D * e]
 #define cpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  Y[dx + max_D1D * dy + max_D1D * max_D1D * dz + max_D1D * max_D1D * max_D1D * e]
 #define cpa_op(qx, qy, qz, d, e)                                       \
-  D[qx + CPA_Q1D * qy + CPA_Q1D * CPA_Q1D * qz + CPA_Q1D * CPA_Q1D * CPA_Q1D * d  +  CPA_VDIM * CPA_Q1D * CPA_Q1D * CPA_Q1D * e]
+  D[qx + max_Q1D * qy + max_Q1D * max_Q1D * qz + max_Q1D * max_Q1D * max_Q1D * d  +  CPA_VDIM * max_Q1D * max_Q1D * max_Q1D * e]
 
 #define CONVECTION3DPA_0_GPU \
   constexpr int max_D1D = CPA_D1D; \
@@ -247,8 +257,8 @@ Index_type NE = m_NE;
 
 
 #define CONVECTION3DPA_0_CPU \
-  constexpr int max_D1D = CPA_D1D; \
-  constexpr int max_Q1D = CPA_Q1D; \
+  constexpr int max_D1D = D1D; \
+  constexpr int max_Q1D = Q1D; \
   constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D; \
   double sm0[max_DQ*max_DQ*max_DQ]; \
   double sm1[max_DQ*max_DQ*max_DQ]; \
@@ -275,7 +285,7 @@ Index_type NE = m_NE;
 #define CONVECTION3DPA_2 \
   double Bu_ = 0.0; \
   double Gu_ = 0.0; \
-  for (int dx = 0; dx < CPA_D1D; ++dx) \
+  for (int dx = 0; dx < max_D1D; ++dx) \
   { \
     const double bx = cpa_B(qx,dx); \
     const double gx = cpa_G(qx,dx); \
@@ -290,7 +300,7 @@ Index_type NE = m_NE;
   double BBu_ = 0.0; \
   double GBu_ = 0.0; \
   double BGu_ = 0.0; \
-  for (int dy = 0; dy < CPA_D1D; ++dy) \
+  for (int dy = 0; dy < max_D1D; ++dy) \
   { \
     const double bx = cpa_B(qy,dy); \
     const double gx = cpa_G(qy,dy); \
@@ -306,7 +316,7 @@ Index_type NE = m_NE;
   double GBBu_ = 0.0; \
   double BGBu_ = 0.0; \
   double BBGu_ = 0.0; \
-  for (int dz = 0; dz < CPA_D1D; ++dz) \
+  for (int dz = 0; dz < max_D1D; ++dz) \
   { \
     const double bx = cpa_B(qz,dz); \
     const double gx = cpa_G(qz,dz); \
@@ -329,7 +339,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_6 \
   double BDGu_ = 0.0; \
-  for (int qz = 0; qz < CPA_Q1D; ++qz) \
+  for (int qz = 0; qz < max_Q1D; ++qz) \
   { \
     const double w = cpa_Bt(dz,qz); \
     BDGu_ += w * DGu[qz][qy][qx]; \
@@ -338,7 +348,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_7 \
   double BBDGu_ = 0.0; \
-  for (int qy = 0; qy < CPA_Q1D; ++qy) \
+  for (int qy = 0; qy < max_Q1D; ++qy) \
   { \
     const double w = cpa_Bt(dy,qy); \
     BBDGu_ += w * BDGu[dz][qy][qx]; \
@@ -347,13 +357,219 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_8 \
   double BBBDGu = 0.0; \
-  for (int qx = 0; qx < CPA_Q1D; ++qx) \
+  for (int qx = 0; qx < max_Q1D; ++qx) \
   { \
     const double w = cpa_Bt(dx,qx); \
     BBBDGu += w * BBDGu[dz][dy][qx]; \
   } \
   cpaY_(dx,dy,dz,e) += BBBDGu;
 
+//
+// simd_elements tuning, each contraction is done for a batch of NB elements
+// at a time with the element in the batch as the fastest index of the
+// intermediate arrays
+//
+#define CONVECTION3DPA_SIMD_0_CPU \
+  constexpr int max_D1D = D1D; \
+  constexpr int max_Q1D = Q1D; \
+  constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D; \
+  constexpr int NB = RAJAPERF_PA_SIMD_WIDTH; \
+  const Index_type e0 = eb * NB; \
+  const int nb = (NE - e0 < NB) ? NE - e0 : NB; \
+  double sm0[max_DQ*max_DQ*max_DQ*NB]; \
+  double sm1[max_DQ*max_DQ*max_DQ*NB]; \
+  double sm2[max_DQ*max_DQ*max_DQ*NB]; \
+  double sm3[max_DQ*max_DQ*max_DQ*NB]; \
+  double sm4[max_DQ*max_DQ*max_DQ*NB]; \
+  double sm5[max_DQ*max_DQ*max_DQ*NB]; \
+  double (*u)[max_D1D][max_D1D][NB] = (double (*)[max_D1D][max_D1D][NB]) sm0; \
+  double (*Bu)[max_D1D][max_Q1D][NB] = (double (*)[max_D1D][max_Q1D][NB]) sm1; \
+  double (*Gu)[max_D1D][max_Q1D][NB] = (double (*)[max_D1D][max_Q1D][NB]) sm2; \
+  double (*BBu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm3; \
+  double (*GBu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm4; \
+  double (*BGu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm5; \
+  double (*GBBu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm0; \
+  double (*BGBu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm1; \
+  double (*BBGu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm2; \
+  double (*DGu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm3; \
+  double (*BDGu)[max_Q1D][max_Q1D][NB] = (double (*)[max_Q1D][max_Q1D][NB]) sm4; \
+  double (*BBDGu)[max_D1D][max_Q1D][NB] = (double (*)[max_D1D][max_Q1D][NB]) sm5;
+
+#define CONVECTION3DPA_SIMD_1 \
+  CPU_FOREACH_BATCH(ie) { \
+    u[dz][dy][dx][ie] = cpaX_(dx,dy,dz,BATCH_ELEM(ie)); \
+  }
+
+#define CONVECTION3DPA_SIMD_2 \
+  double Bu_[NB], Gu_[NB]; \
+  CPU_FOREACH_BATCH(ie) { Bu_[ie] = 0.0; Gu_[ie] = 0.0; } \
+  for (int dx = 0; dx < max_D1D; ++dx) \
+  { \
+    const double bx = cpa_B(qx,dx); \
+    const double gx = cpa_G(qx,dx); \
+    CPU_FOREACH_BATCH(ie) { \
+      const double x = u[dz][dy][dx][ie]; \
+      Bu_[ie] += bx * x; \
+      Gu_[ie] += gx * x; \
+    } \
+  } \
+  CPU_FOREACH_BATCH(ie) { \
+    Bu[dz][dy][qx][ie] = Bu_[ie]; \
+    Gu[dz][dy][qx][ie] = Gu_[ie]; \
+  }
+
+#define CONVECTION3DPA_SIMD_3 \
+  double BBu_[NB], GBu_[NB], BGu_[NB]; \
+  CPU_FOREACH_BATCH(ie) { BBu_[ie] = 0.0; GBu_[ie] = 0.0; BGu_[ie] = 0.0; } \
+  for (int dy = 0; dy < max_D1D; ++dy) \
+  { \
+    const double bx = cpa_B(qy,dy); \
+    const double gx = cpa_G(qy,dy); \
+    CPU_FOREACH_BATCH(ie) { \
+      BBu_[ie] += bx * Bu[dz][dy][qx][ie]; \
+      GBu_[ie] += gx * Bu[dz][dy][qx][ie]; \
+      BGu_[ie] += bx * Gu[dz][dy][qx][ie]; \
+    } \
+  } \
+  CPU_FOREACH_BATCH(ie) { \
+    BBu[dz][qy][qx][ie] = BBu_[ie]; \
+    GBu[dz][qy][qx][ie] = GBu_[ie]; \
+    BGu[dz][qy][qx][ie] = BGu_[ie]; \
+  }
+
+#define CONVECTION3DPA_SIMD_4 \
+  double GBBu_[NB], BGBu_[NB], BBGu_[NB]; \
+  CPU_FOREACH_BATCH(ie) { GBBu_[ie] = 0.0; BGBu_[ie] = 0.0; BBGu_[ie] = 0.0; } \
+  for (int dz = 0; dz < max_D1D; ++dz) \
+  { \
+    const double bx = cpa_B(qz,dz); \
+    const double gx = cpa_G(qz,dz); \
+    CPU_FOREACH_BATCH(ie) { \
+      GBBu_[ie] += gx * BBu[dz][qy][qx][ie]; \
+      BGBu_[ie] += bx * GBu[dz][qy][qx][ie]; \
+      BBGu_[ie] += bx * BGu[dz][qy][qx][ie]; \
+    } \
+  } \
+  CPU_FOREACH_BATCH(ie) { \
+    GBBu[qz][qy][qx][ie] = GBBu_[ie]; \
+    BGBu[qz][qy][qx][ie] = BGBu_[ie]; \
+    BBGu[qz][qy][qx][ie] = BBGu_[ie]; \
+  }
+
+#define CONVECTION3DPA_SIMD_5 \
+  CPU_FOREACH_BATCH(ie) { \
+    const Index_type e = BATCH_ELEM(ie); \
+    const double O1 = cpa_op(qx,qy,qz,0,e); \
+    const double O2 = cpa_op(qx,qy,qz,1,e); \
+    const double O3 = cpa_op(qx,qy,qz,2,e); \
+    const double gradX = BBGu[qz][qy][qx][ie]; \
+    const double gradY = BGBu[qz][qy][qx][ie]; \
+    const double gradZ = GBBu[qz][qy][qx][ie]; \
+    DGu[qz][qy][qx][ie] = (O1 * gradX) + (O2 * gradY) + (O3 * gradZ); \
+  }
+
+#define CONVECTION3DPA_SIMD_6 \
+  double BDGu_[NB]; \
+  CPU_FOREACH_BATCH(ie) { BDGu_[ie] = 0.0; } \
+  for (int qz = 0; qz < max_Q1D; ++qz) \
+  { \
+    const double w = cpa_Bt(dz,qz); \
+    CPU_FOREACH_BATCH(ie) { \
+      BDGu_[ie] += w * DGu[qz][qy][qx][ie]; \
+    } \
+  } \
+  CPU_FOREACH_BATCH(ie) { \
+    BDGu[dz][qy][qx][ie] = BDGu_[ie]; \
+  }
+
+#define CONVECTION3DPA_SIMD_7 \
+  double BBDGu_[NB]; \
+  CPU_FOREACH_BATCH(ie) { BBDGu_[ie] = 0.0; } \
+  for (int qy = 0; qy < max_Q1D; ++qy) \
+  { \
+    const double w = cpa_Bt(dy,qy); \
+    CPU_FOREACH_BATCH(ie) { \
+      BBDGu_[ie] += w * BDGu[dz][qy][qx][ie]; \
+    } \
+  } \
+  CPU_FOREACH_BATCH(ie) { \
+    BBDGu[dz][dy][qx][ie] = BBDGu_[ie]; \
+  }
+
+#define CONVECTION3DPA_SIMD_8 \
+  double BBBDGu[NB]; \
+  CPU_FOREACH_BATCH(ie) { BBBDGu[ie] = 0.0; } \
+  for (int qx = 0; qx < max_Q1D; ++qx) \
+  { \
+    const double w = cpa_Bt(dx,qx); \
+    CPU_FOREACH_BATCH(ie) { \
+      BBBDGu[ie] += w * BBDGu[dz][dy][qx][ie]; \
+    } \
+  } \
+  for (int ie = 0; ie < nb; ++ie) { \
+    cpaY_(dx,dy,dz,(e0 + ie)) += BBBDGu[ie]; \
+  }
+
+// batch eb of elements, same loop nests as the default tuning
+#define CONVECTION3DPA_SIMD_BODY \
+  CONVECTION3DPA_SIMD_0_CPU \
+  CPU_FOREACH(dz, z, max_D1D) { \
+    CPU_FOREACH(dy, y, max_D1D) { \
+      CPU_FOREACH(dx, x, max_D1D) { \
+        CONVECTION3DPA_SIMD_1 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, max_D1D) { \
+    CPU_FOREACH(dy, y, max_D1D) { \
+      CPU_FOREACH(qx, x, max_Q1D) { \
+        CONVECTION3DPA_SIMD_2 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, max_D1D) { \
+    CPU_FOREACH(qx, x, max_Q1D) { \
+      CPU_FOREACH(qy, y, max_Q1D) { \
+        CONVECTION3DPA_SIMD_3 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(qx, x, max_Q1D) { \
+    CPU_FOREACH(qy, y, max_Q1D) { \
+      CPU_FOREACH(qz, z, max_Q1D) { \
+        CONVECTION3DPA_SIMD_4 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(qz, z, max_Q1D) { \
+    CPU_FOREACH(qy, y, max_Q1D) { \
+      CPU_FOREACH(qx, x, max_Q1D) { \
+        CONVECTION3DPA_SIMD_5 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(qx, x, max_Q1D) { \
+    CPU_FOREACH(qy, y, max_Q1D) { \
+      CPU_FOREACH(dz, z, max_D1D) { \
+        CONVECTION3DPA_SIMD_6 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, max_D1D) { \
+    CPU_FOREACH(qx, x, max_Q1D) { \
+      CPU_FOREACH(dy, y, max_D1D) { \
+        CONVECTION3DPA_SIMD_7 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, max_D1D) { \
+    CPU_FOREACH(dy, y, max_D1D) { \
+      CPU_FOREACH(dx, x, max_D1D) { \
+        CONVECTION3DPA_SIMD_8 \
+      } \
+    } \
+  }
+
 namespace rajaperf
 {
 class RunParams;
@@ -379,16 +595,27 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantSimdImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantSimdImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = CPA_Q1D * CPA_Q1D * CPA_Q1D;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  using pa_orders_type = camp::int_seq<int, RAJAPERF_PA_ORDERS>;
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -398,6 +625,9 @@ private:
   Real_ptr m_X;
   Real_ptr m_Y;
 
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
   Index_type m_NE;
   Index_type m_NE_default;
 };
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void COUPLE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( getVariantTuningName(vid, tune_idx) == "soa" ) {
+
+    runSeqVariantSoa(vid);
+    return;
+
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          COUPLE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto couple_lam = [=](Index_type k) {
+                          COUPLE_BODY;
+                        };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          couple_lam(k);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void COUPLE::runSeqVariantSoa(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_SOA_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          COUPLE_SOA_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_SOA_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void COUPLE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "soa");
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
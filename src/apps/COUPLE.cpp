@@ -6,20 +6,47 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
-#include "WIP-COUPLE.hpp"
+#include "COUPLE.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
-#include <iostream>
+#include <cmath>
 
 namespace rajaperf
 {
 namespace apps
 {
 
+namespace {
+
+//
+// Copy the real and imaginary parts of a complex array to new real arrays.
+//
+void splitComplex(const Complex_ptr c, Real_ptr& re, Real_ptr& im, Index_type len)
+{
+  allocData(re, len);
+  allocData(im, len);
+  for (Index_type i = 0; i < len; ++i) {
+    re[i] = real(c[i]);
+    im[i] = imag(c[i]);
+  }
+}
+
+//
+// Copy real and imaginary parts back to a complex array.
+//
+void mergeComplex(Complex_ptr c, const Real_ptr re, const Real_ptr im, Index_type len)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    c[i] = Complex_type(re[i], im[i]);
+  }
+}
+
+} // end namespace
+
 
 COUPLE::COUPLE(const RunParams& params)
   : KernelBase(rajaperf::Apps_COUPLE, params)
@@ -41,16 +68,36 @@ COUPLE::COUPLE(const RunParams& params)
 
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  setBytesPerRep( (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * m_domain->n_real_zones );
-  setFLOPsPerRep(0);
+  setBytesPerRep( (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * getActualProblemSize() );
+  // complex multiply counted as 6 FLOPs, sqrt, sin and cos as 1 FLOP each
+  setFLOPsPerRep((4  +   // c1, c2
+                  17 +   // zlam, snlamt, cslamt, a2t
+                  11 +   // r_zlam, c1, c2, zac1, zac2
+                  26 +   // A0
+                  37 +   // A1
+                  39     // A2
+                  ) * getActualProblemSize());
 
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
+
+  m_t0_re = nullptr;
+  m_t0_im = nullptr;
+  m_t1_re = nullptr;
+  m_t1_im = nullptr;
+  m_t2_re = nullptr;
+  m_t2_im = nullptr;
+  m_denac_re = nullptr;
+  m_denac_im = nullptr;
+  m_denlw_re = nullptr;
+  m_denlw_im = nullptr;
 }
 
 COUPLE::~COUPLE()
@@ -58,7 +105,7 @@ COUPLE::~COUPLE()
   delete m_domain;
 }
 
-void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COUPLE::setUp(VariantID vid, size_t tune_idx)
 {
   Index_type max_loop_index = m_domain->lrn;
 
@@ -78,105 +125,13 @@ void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   m_r_fratio = 1.0/m_fratio;
   m_c20 = 0.25 * (m_clight / m_csound) * m_r_fratio;
   m_ireal = Complex_type(0.0, 1.0);
-}
-
-void COUPLE::runKernel(VariantID vid, size_t tune_idx)
-{
-  RAJA_UNUSED_VAR(tune_idx);
-  const Index_type run_reps = getRunReps();
-
-  COUPLE_DATA_SETUP;
-
-  switch ( vid ) {
-
-    case Base_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-
-      break;
-    }
-
-#if defined(RUN_RAJA_SEQ)
-    case RAJA_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::loop_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-    case Base_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        #pragma omp parallel for
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-      break;
-    }
-
-    case RAJA_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_TARGET_OPENMP) && 0
-    case Base_OpenMPTarget :
-    case RAJA_OpenMPTarget :
-    {
-      runOpenMPTargetVariant(vid, tune_idx);
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_CUDA) && 0
-    case Base_CUDA :
-    case RAJA_CUDA :
-    {
-      runCudaVariant(vid, tune_idx);
-      break;
-    }
-#endif
-
-    default : {
-      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
-    }
 
+  if ( getVariantTuningName(vid, tune_idx) == "soa" ) {
+    splitComplex(m_t0, m_t0_re, m_t0_im, max_loop_index);
+    splitComplex(m_t1, m_t1_re, m_t1_im, max_loop_index);
+    splitComplex(m_t2, m_t2_re, m_t2_im, max_loop_index);
+    splitComplex(m_denac, m_denac_re, m_denac_im, max_loop_index);
+    splitComplex(m_denlw, m_denlw_re, m_denlw_im, max_loop_index);
   }
 }
 
@@ -184,6 +139,12 @@ void COUPLE::updateChecksum(VariantID vid, size_t tune_idx)
 {
   Index_type max_loop_index = m_domain->lrn;
 
+  if ( getVariantTuningName(vid, tune_idx) == "soa" ) {
+    mergeComplex(m_t0, m_t0_re, m_t0_im, max_loop_index);
+    mergeComplex(m_t1, m_t1_re, m_t1_im, max_loop_index);
+    mergeComplex(m_t2, m_t2_re, m_t2_im, max_loop_index);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_t0, max_loop_index);
   checksum[vid][tune_idx] += calcChecksum(m_t1, max_loop_index);
   checksum[vid][tune_idx] += calcChecksum(m_t2, max_loop_index);
@@ -198,6 +159,17 @@ void COUPLE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_t2);
   deallocData(m_denac);
   deallocData(m_denlw);
+
+  deallocData(m_t0_re);
+  deallocData(m_t0_im);
+  deallocData(m_t1_re);
+  deallocData(m_t1_im);
+  deallocData(m_t2_re);
+  deallocData(m_t2_im);
+  deallocData(m_denac_re);
+  deallocData(m_denac_im);
+  deallocData(m_denlw_re);
+  deallocData(m_denlw_im);
 }
 
 } // end namespace apps
@@ -64,6 +64,11 @@
 ///   } /* j loop */
 /// } /* k loop */
 ///
+/// The Base and RAJA host variants also have a "soa" tuning that stores the
+/// real and imaginary parts of each complex array in separate arrays and
+/// spells out the complex arithmetic of the body above on real values,
+/// see COUPLE_SOA_BODY.
+///
 
 #ifndef RAJAPerf_Apps_COUPLE_HPP
 #define RAJAPerf_Apps_COUPLE_HPP
@@ -142,6 +147,103 @@ for (Index_type j = jmin; j < jmax; j++) { \
  \
 } /* j loop */
 
+#define COUPLE_SOA_DATA_SETUP \
+  Real_ptr t0_re = m_t0_re; \
+  Real_ptr t0_im = m_t0_im; \
+  Real_ptr t1_re = m_t1_re; \
+  Real_ptr t1_im = m_t1_im; \
+  Real_ptr t2_re = m_t2_re; \
+  Real_ptr t2_im = m_t2_im; \
+  Real_ptr denac_re = m_denac_re; \
+  Real_ptr denac_im = m_denac_im; \
+  Real_ptr denlw_re = m_denlw_re; \
+  Real_ptr denlw_im = m_denlw_im; \
+  const Real_type dt = m_dt; \
+  const Real_type c10 = m_c10; \
+  const Real_type fratio = m_fratio; \
+  const Real_type r_fratio = m_r_fratio; \
+  const Real_type c20 = m_c20; \
+ \
+  const Index_type imin = m_imin; \
+  const Index_type imax = m_imax; \
+  const Index_type jmin = m_jmin; \
+  const Index_type jmax = m_jmax; \
+  const Index_type kmin = m_kmin; \
+  const Index_type kmax = m_kmax;
+
+//
+// COUPLE_BODY on split real and imaginary parts, the operations are done in
+// the same order as the std::complex operators, multiplying by ireal is a
+// swap of the parts.
+//
+#define COUPLE_SOA_BODY \
+for (Index_type j = jmin; j < jmax; j++) { \
+ \
+   Index_type it0=    ((k)*(jmax+1) + (j))*(imax+1) ; \
+   Index_type idenac= ((k)*(jmax+2) + (j))*(imax+2) ; \
+ \
+   for (Index_type i = imin; i < imax; i++) { \
+ \
+      Real_type c1re = c10 * denac_re[idenac+i]; \
+      Real_type c1im = c10 * denac_im[idenac+i]; \
+      Real_type c2re = c20 * denlw_re[it0+i]; \
+      Real_type c2im = c20 * denlw_im[it0+i]; \
+ \
+      Real_type zlam = c1re*c1re + c1im*c1im + \
+                       c2re*c2re + c2im*c2im + 1.0e-34; \
+      zlam = sqrt(zlam); \
+      Real_type snlamt = sin(zlam * dt * 0.5); \
+      Real_type cslamt = cos(zlam * dt * 0.5); \
+ \
+      Real_type a0tre = t0_re[it0+i]; \
+      Real_type a0tim = t0_im[it0+i]; \
+      Real_type a1tre = t1_re[it0+i]; \
+      Real_type a1tim = t1_im[it0+i]; \
+      Real_type a2tre = t2_re[it0+i] * fratio; \
+      Real_type a2tim = t2_im[it0+i] * fratio; \
+ \
+      Real_type r_zlam= 1.0/zlam; \
+      c1re *= r_zlam; \
+      c1im *= r_zlam; \
+      c2re *= r_zlam; \
+      c2im *= r_zlam; \
+      Real_type zac1 = c1re*c1re + c1im*c1im; \
+      Real_type zac2 = c2re*c2re + c2im*c2im; \
+ \
+      /* compute new A0 */ \
+      Real_type z3re = ( (c1re*a1tre - c1im*a1tim) + \
+                         (c2re*a2tre - c2im*a2tim) ) * snlamt; \
+      Real_type z3im = ( (c1re*a1tim + c1im*a1tre) + \
+                         (c2re*a2tim + c2im*a2tre) ) * snlamt; \
+      t0_re[it0+i] = a0tre * cslamt + z3im; \
+      t0_im[it0+i] = a0tim * cslamt - z3re; \
+ \
+      /* compute new A1  */ \
+      Real_type r = zac1 * cslamt + zac2; \
+      Real_type z5re = c2re*a2tre - c2im*a2tim; \
+      Real_type z5im = c2re*a2tim + c2im*a2tre; \
+      Real_type z4re = (c1re*z5re + c1im*z5im) * (cslamt-1); \
+      Real_type z4im = (c1re*z5im - c1im*z5re) * (cslamt-1); \
+      z3re = (c1re*a0tre + c1im*a0tim) * snlamt; \
+      z3im = (c1re*a0tim - c1im*a0tre) * snlamt; \
+      t1_re[it0+i] = a1tre * r + z4re + z3im; \
+      t1_im[it0+i] = a1tim * r + z4im - z3re; \
+ \
+      /* compute new A2  */ \
+      r = zac1 + zac2 * cslamt; \
+      z5re = c1re*a1tre - c1im*a1tim; \
+      z5im = c1re*a1tim + c1im*a1tre; \
+      z4re = (c2re*z5re + c2im*z5im) * (cslamt-1); \
+      z4im = (c2re*z5im - c2im*z5re) * (cslamt-1); \
+      z3re = (c2re*a0tre + c2im*a0tim) * snlamt; \
+      z3im = (c2re*a0tim - c2im*a0tre) * snlamt; \
+      t2_re[it0+i] = ( a2tre * r + z4re + z3im ) * r_fratio; \
+      t2_im[it0+i] = ( a2tim * r + z4im - z3re ) * r_fratio; \
+ \
+   } /* i loop */ \
+ \
+} /* j loop */
+
 
 #include "common/KernelBase.hpp"
 
@@ -162,15 +264,28 @@ public:
   ~COUPLE();
 
   void setUp(VariantID vid, size_t tune_idx);
-  void runKernel(VariantID vid, size_t tune_idx);
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
-  void runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantSoa(VariantID vid);
+  void runOpenMPVariantSoa(VariantID vid);
 
 private:
   Complex_ptr m_t0;
@@ -179,6 +294,17 @@ private:
   Complex_ptr m_denac;
   Complex_ptr m_denlw;
 
+  Real_ptr m_t0_re;
+  Real_ptr m_t0_im;
+  Real_ptr m_t1_re;
+  Real_ptr m_t1_im;
+  Real_ptr m_t2_re;
+  Real_ptr m_t2_im;
+  Real_ptr m_denac_re;
+  Real_ptr m_denac_im;
+  Real_ptr m_denlw_re;
+  Real_ptr m_denlw_im;
+
   Real_type m_clight;
   Real_type m_csound;
   Real_type m_omega0;
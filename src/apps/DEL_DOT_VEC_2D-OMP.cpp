@@ -22,10 +22,24 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                               prefetch_distances_type>(
+         getVariantTuningName(vid, tune_idx),
+         [&](auto distance) { runOpenMPVariantPrefetch<distance>(vid); }) ) {
+
+    return;
+
+  } else if ( tune_idx > 0 ) {
+
+    runOpenMPVariantUnstructured(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -105,10 +119,149 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariantUnstructured(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_nzones;
+
+  DEL_DOT_VEC_2D_UNSTRUCTURED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY_INDEX;
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY_INDEX;
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t distance >
+void DEL_DOT_VEC_2D::runOpenMPVariantPrefetch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+
+  NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+  NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+  NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_PREFETCH_BODY(distance);
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_PREFETCH_BODY(distance);
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void DEL_DOT_VEC_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    for (int io = 0; io < static_cast<int>(MeshOrdering::NumMeshOrderings); ++io) {
+      addVariantTuningName(vid, getMeshOrderingTuningName(static_cast<MeshOrdering>(io)));
+    }
+  }
+
+  if ( ( vid == Base_OpenMP || vid == RAJA_OpenMP ) && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -22,8 +22,22 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                               prefetch_distances_type>(
+         getVariantTuningName(vid, tune_idx),
+         [&](auto distance) { runSeqVariantPrefetch<distance>(vid); }) ) {
+
+    return;
+
+  } else if ( tune_idx > 0 ) {
+
+    runSeqVariantUnstructured(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -105,5 +119,135 @@ void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void DEL_DOT_VEC_2D::runSeqVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_nzones;
+
+  DEL_DOT_VEC_2D_UNSTRUCTURED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY_INDEX;
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY_INDEX;
+          DEL_DOT_VEC_2D_UNSTRUCTURED_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t distance >
+void DEL_DOT_VEC_2D::runSeqVariantPrefetch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+
+  NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+  NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+  NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_PREFETCH_BODY(distance);
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          DEL_DOT_VEC_2D_PREFETCH_BODY(distance);
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DEL_DOT_VEC_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    for (int io = 0; io < static_cast<int>(MeshOrdering::NumMeshOrderings); ++io) {
+      addVariantTuningName(vid, getMeshOrderingTuningName(static_cast<MeshOrdering>(io)));
+    }
+  }
+
+  if ( ( vid == Base_Seq || vid == RAJA_Seq ) && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 
@@ -62,6 +63,16 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  m_nzones = m_domain->n_real_zones;
+  m_nnodes = 0;
+  m_zone_order = nullptr;
+  m_zone_nodes = nullptr;
+  m_node_x = nullptr;
+  m_node_y = nullptr;
+  m_node_xdot = nullptr;
+  m_node_ydot = nullptr;
+  m_zone_div = nullptr;
 }
 
 DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
@@ -69,7 +80,7 @@ DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
   delete m_domain;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -85,10 +96,46 @@ void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   m_ptiny = 1.0e-20;
   m_half = 0.5;
+
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  for (int io = 0; io < static_cast<int>(MeshOrdering::NumMeshOrderings); ++io) {
+    MeshOrdering ordering = static_cast<MeshOrdering>(io);
+    if ( tuning_name != getMeshOrderingTuningName(ordering) ) continue;
+
+    UnstructuredMesh mesh;
+    setUnstructuredMesh(mesh, m_domain->real_zones, m_nzones, *m_domain, ordering);
+    m_nnodes = mesh.node_order.size();
+
+    allocData(m_zone_order, m_nzones);
+    allocData(m_zone_nodes, 4*m_nzones);
+    std::copy(mesh.zone_order.begin(), mesh.zone_order.end(), m_zone_order);
+    std::copy(mesh.zone_nodes.begin(), mesh.zone_nodes.end(), m_zone_nodes);
+
+    allocData(m_node_x, m_nnodes);
+    allocData(m_node_y, m_nnodes);
+    allocData(m_node_xdot, m_nnodes);
+    allocData(m_node_ydot, m_nnodes);
+    for (Index_type n = 0; n < m_nnodes; ++n) {
+      m_node_x[n] = m_x[mesh.node_order[n]];
+      m_node_y[n] = m_y[mesh.node_order[n]];
+      m_node_xdot[n] = m_xdot[mesh.node_order[n]];
+      m_node_ydot[n] = m_ydot[mesh.node_order[n]];
+    }
+
+    allocAndInitDataConst(m_zone_div, m_nzones, 0.0, vid);
+  }
 }
 
 void DEL_DOT_VEC_2D::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( m_zone_div != nullptr ) {
+    // checksum the zones in the numbering of the domain
+    for (Index_type iz = 0; iz < m_nzones; ++iz) {
+      m_div[m_zone_order[iz]] = m_zone_div[iz];
+    }
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_div, m_array_length);
 }
 
@@ -101,6 +148,13 @@ void DEL_DOT_VEC_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
   deallocData(m_xdot);
   deallocData(m_ydot);
   deallocData(m_div);
+  deallocData(m_zone_order);
+  deallocData(m_zone_nodes);
+  deallocData(m_node_x);
+  deallocData(m_node_y);
+  deallocData(m_node_xdot);
+  deallocData(m_node_ydot);
+  deallocData(m_zone_div);
 }
 
 } // end namespace apps
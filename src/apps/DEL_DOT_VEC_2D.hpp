@@ -36,6 +36,18 @@
 ///   div[i] = dfxdx + dfydy + affine ;
 /// }
 ///
+/// The "unstructured*" tunings of the Base and RAJA host variants store the
+/// mesh as an unstructured mesh, zone i reads its nodes through the zone to
+/// node connectivity (zone_nodes[4*i + c] replaces x1..x4 etc.). The zones and
+/// nodes are numbered in lexicographic, random, Morton, Hilbert or reverse
+/// Cuthill-McKee order, see MeshOrdering in AppsData.hpp. Bytes per rep do
+/// not include the connectivity.
+///
+/// The "prefetch_<N>" tunings of the Base and RAJA host variants prefetch
+/// the node values and div of zone real_zones[ii + N] in iteration ii, one
+/// prefetch per mesh row of each array, see the prefetch namespace in
+/// HostUtils.hpp.
+///
 
 #ifndef RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 #define RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
@@ -60,6 +72,20 @@
 #define DEL_DOT_VEC_2D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
+#define DEL_DOT_VEC_2D_PREFETCH_BODY(distance) \
+  if ( ii + distance < iend ) { \
+    const Index_type ip = real_zones[ii + distance]; \
+    prefetch::read(&x4[ip]); \
+    prefetch::read(&x3[ip]); \
+    prefetch::read(&y4[ip]); \
+    prefetch::read(&y3[ip]); \
+    prefetch::read(&fx4[ip]); \
+    prefetch::read(&fx3[ip]); \
+    prefetch::read(&fy4[ip]); \
+    prefetch::read(&fy3[ip]); \
+    prefetch::write(&div[ip]); \
+  }
+
 #define DEL_DOT_VEC_2D_BODY \
 \
   Real_type xi  = half * ( x1[i]  + x2[i]  - x3[i]  - x4[i]  ) ; \
@@ -85,6 +111,49 @@
  \
   div[i] = dfxdx + dfydy + affine ;
 
+#define DEL_DOT_VEC_2D_UNSTRUCTURED_DATA_SETUP \
+  Real_ptr x = m_node_x; \
+  Real_ptr y = m_node_y; \
+  Real_ptr xdot = m_node_xdot; \
+  Real_ptr ydot = m_node_ydot; \
+  Real_ptr div = m_zone_div; \
+  Int_ptr zone_nodes = m_zone_nodes; \
+\
+  const Real_type ptiny = m_ptiny; \
+  const Real_type half = m_half;
+
+#define DEL_DOT_VEC_2D_UNSTRUCTURED_BODY_INDEX \
+  const Index_type n1 = zone_nodes[4*i + 0] ; \
+  const Index_type n2 = zone_nodes[4*i + 1] ; \
+  const Index_type n3 = zone_nodes[4*i + 2] ; \
+  const Index_type n4 = zone_nodes[4*i + 3] ;
+
+#define DEL_DOT_VEC_2D_UNSTRUCTURED_BODY \
+\
+  Real_type xi  = half * ( x[n1]  + x[n2]  - x[n3]  - x[n4]  ) ; \
+  Real_type xj  = half * ( x[n2]  + x[n3]  - x[n4]  - x[n1]  ) ; \
+ \
+  Real_type yi  = half * ( y[n1]  + y[n2]  - y[n3]  - y[n4]  ) ; \
+  Real_type yj  = half * ( y[n2]  + y[n3]  - y[n4]  - y[n1]  ) ; \
+ \
+  Real_type fxi = half * ( xdot[n1] + xdot[n2] - xdot[n3] - xdot[n4] ) ; \
+  Real_type fxj = half * ( xdot[n2] + xdot[n3] - xdot[n4] - xdot[n1] ) ; \
+ \
+  Real_type fyi = half * ( ydot[n1] + ydot[n2] - ydot[n3] - ydot[n4] ) ; \
+  Real_type fyj = half * ( ydot[n2] + ydot[n3] - ydot[n4] - ydot[n1] ) ; \
+ \
+  Real_type rarea  = 1.0 / ( xi * yj - xj * yi + ptiny ) ; \
+ \
+  Real_type dfxdx  = rarea * ( fxi * yj - fxj * yi ) ; \
+ \
+  Real_type dfydy  = rarea * ( fyj * xi - fyi * xj ) ; \
+ \
+  Real_type affine = ( ydot[n1] + ydot[n2] + ydot[n3] + ydot[n4] ) / \
+                     ( y[n1]  + y[n2]  + y[n3]  + y[n4]  ) ; \
+ \
+  div[i] = dfxdx + dfydy + affine ;
+
+
 
 #include "common/KernelBase.hpp"
 
@@ -114,16 +183,26 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void runSeqVariantUnstructured(VariantID vid);
+  void runOpenMPVariantUnstructured(VariantID vid);
+  template < size_t distance >
+  void runSeqVariantPrefetch(VariantID vid);
+  template < size_t distance >
+  void runOpenMPVariantPrefetch(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  using prefetch_distances_type = host_tuning::make_list_type<host_tuning::prefetch_distance,
+                                                              host_tuning::list_type<8, 32, 128>>;
 
   Real_ptr m_x;
   Real_ptr m_y;
@@ -136,6 +215,16 @@ private:
 
   ADomain* m_domain;
   Index_type m_array_length;
+
+  Index_type m_nzones;
+  Index_type m_nnodes;
+  Int_ptr m_zone_order;
+  Int_ptr m_zone_nodes;
+  Real_ptr m_node_x;
+  Real_ptr m_node_y;
+  Real_ptr m_node_xdot;
+  Real_ptr m_node_ydot;
+  Real_ptr m_zone_div;
 };
 
 } // end namespace apps
@@ -18,7 +18,8 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void DIFFUSION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -37,69 +38,69 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
         DIFFUSION3DPA_0_CPU;
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_1;
             }
           }
         }
 
-        CPU_FOREACH(dy, y, DPA_D1D) {
-          CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             DIFFUSION3DPA_2;
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_3;
             }
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_4;
             }
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_5;
             }
           }
         }
 
-        CPU_FOREACH(d, y, DPA_D1D) {
-          CPU_FOREACH(q, x, DPA_Q1D) {
+        CPU_FOREACH(d, y, D1D) {
+          CPU_FOREACH(q, x, Q1D) {
             DIFFUSION3DPA_6;
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_7;
             }
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_8;
             }
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_9;
             }
           }
@@ -138,11 +139,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
               DIFFUSION3DPA_0_CPU;
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           DIFFUSION3DPA_1;
@@ -158,9 +159,9 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
               RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                 [&](int RAJA_UNUSED_ARG(dz)) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_2;
@@ -174,11 +175,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_3;
@@ -192,11 +193,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_4;
@@ -210,11 +211,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int qx) {
 
                          DIFFUSION3DPA_5;
@@ -230,9 +231,9 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                [&](int RAJA_UNUSED_ARG(dz)) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int d) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int q) {
 
                          DIFFUSION3DPA_6;
@@ -246,11 +247,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_7;
@@ -264,11 +265,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_8;
@@ -282,11 +283,11 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                [&](int dz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_9;
@@ -319,5 +320,83 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < int D1D, int Q1D >
+void DIFFUSION3DPA::runOpenMPVariantSimdImpl(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  DIFFUSION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        DIFFUSION3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  case RAJA_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        DIFFUSION3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n DIFFUSION3DPA : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runOpenMPVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runOpenMPVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void DIFFUSION3DPA::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
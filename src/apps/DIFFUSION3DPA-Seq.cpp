@@ -18,7 +18,8 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void DIFFUSION3DPA::runSeqVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   DIFFUSION3DPA_DATA_SETUP;
@@ -34,69 +35,69 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
         DIFFUSION3DPA_0_CPU;
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_1;
             }
           }
         }
 
-        CPU_FOREACH(dy, y, DPA_D1D) {
-          CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             DIFFUSION3DPA_2;
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_3;
             }
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_4;
             }
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(qx, x, Q1D) {
               DIFFUSION3DPA_5;
             }
           }
         }
 
-        CPU_FOREACH(d, y, DPA_D1D) {
-          CPU_FOREACH(q, x, DPA_Q1D) {
+        CPU_FOREACH(d, y, D1D) {
+          CPU_FOREACH(q, x, Q1D) {
             DIFFUSION3DPA_6;
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(qy, y, Q1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_7;
             }
           }
         }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(qz, z, Q1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_8;
             }
           }
         }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
+        CPU_FOREACH(dz, z, D1D) {
+          CPU_FOREACH(dy, y, D1D) {
+            CPU_FOREACH(dx, x, D1D) {
               DIFFUSION3DPA_9;
             }
           }
@@ -136,11 +137,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
               DIFFUSION3DPA_0_CPU;
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                         [&](int dx) {
 
                           DIFFUSION3DPA_1;
@@ -156,9 +157,9 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
               RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                 [&](int RAJA_UNUSED_ARG(dz)) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_2;
@@ -172,11 +173,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_3;
@@ -190,11 +191,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dz) {
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qy) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                         [&](int qx) {
 
                           DIFFUSION3DPA_4;
@@ -208,11 +209,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int qx) {
 
                          DIFFUSION3DPA_5;
@@ -228,9 +229,9 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
              RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, 1),
                [&](int RAJA_UNUSED_ARG(dz)) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int d) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                        [&](int q) {
 
                          DIFFUSION3DPA_6;
@@ -244,11 +245,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                    [&](int qy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_7;
@@ -262,11 +263,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_Q1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, Q1D),
                [&](int qz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_8;
@@ -280,11 +281,11 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
              ctx.teamSync();
 
-             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+             RAJA::expt::loop<inner_z>(ctx, RAJA::RangeSegment(0, D1D),
                [&](int dz) {
-                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                 RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                    [&](int dy) {
-                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, DPA_D1D),
+                     RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                        [&](int dx) {
 
                          DIFFUSION3DPA_9;
@@ -314,5 +315,76 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
   }
 }
 
+template < int D1D, int Q1D >
+void DIFFUSION3DPA::runSeqVariantSimdImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  DIFFUSION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        DIFFUSION3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+#if defined(RUN_RAJA_SEQ)
+  case RAJA_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::loop_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        DIFFUSION3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+#endif // RUN_RAJA_SEQ
+
+  default:
+    getCout() << "\n DIFFUSION3DPA : Unknown Seq variant id = " << vid << std::endl;
+  }
+}
+
+void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runSeqVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runSeqVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void DIFFUSION3DPA::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -209,6 +209,15 @@
 ///
 /// } // element loop
 ///
+/// The default order has DPA_D1D dofs and DPA_Q1D quadrature points in 1D.
+/// The host variants are templated on (D1D, Q1D) and also run the order
+/// set with --pa-order, order p has D1D = p+1 and Q1D = p+2.
+///
+/// The "simd_elements" tuning of the Base and RAJA host variants runs
+/// batches of RAJAPERF_PA_SIMD_WIDTH elements, the batch is the fastest
+/// index of the intermediate arrays so each contraction vectorizes across
+/// the elements of the batch.
+///
 
 #ifndef RAJAPerf_Apps_DIFFUSION3DPA_HPP
 #define RAJAPerf_Apps_DIFFUSION3DPA_HPP
@@ -227,18 +236,19 @@ const bool symmetric = true;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
+//Number of Dofs/Qpts in 1D of the default order, GPU variants only run
+//this order, host variants run any order in RAJAPERF_PA_ORDERS
 #define DPA_D1D 3
 #define DPA_Q1D 4
 #define SYM 6
-#define b(x, y) Basis[x + DPA_Q1D * y]
-#define g(x, y) dBasis[x + DPA_Q1D * y]
+#define b(x, y) Basis[x + MQ1 * y]
+#define g(x, y) dBasis[x + MQ1 * y]
 #define dpaX_(dx, dy, dz, e)                                                      \
-  X[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define dpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define d(qx, qy, qz, s, e)                                                    \
-  D[qx + DPA_Q1D * qy + DPA_Q1D * DPA_Q1D * qz + DPA_Q1D * DPA_Q1D * DPA_Q1D * s  +  DPA_Q1D * DPA_Q1D * DPA_Q1D * SYM * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * s  +  MQ1 * MQ1 * MQ1 * SYM * e]
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
 // Indices computation for SmemPADiffusionApply3D.
@@ -295,8 +305,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         double (*QDD2)[MD1][MD1] = (double (*)[MD1][MD1]) (sm0+2);
 
 #define DIFFUSION3DPA_0_CPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -325,22 +335,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         s_X[dz][dy][dx] = dpaX_(dx,dy,dz,e);
 
 #define DIFFUSION3DPA_2 \
-        const int i = qi(qx,dy,DPA_Q1D); \
-        const int j = dj(qx,dy,DPA_D1D); \
-        const int k = qk(qx,dy,DPA_Q1D); \
-        const int l = dl(qx,dy,DPA_D1D); \
+        const int i = qi(qx,dy,MQ1); \
+        const int j = dj(qx,dy,MD1); \
+        const int k = qk(qx,dy,MQ1); \
+        const int l = dl(qx,dy,MD1); \
         B[i][j] = b(qx,dy); \
         G[k][l] = g(qx,dy) * sign(qx,dy); \
 
 #define DIFFUSION3DPA_3 \
            double u = 0.0, v = 0.0; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dx = 0; dx < DPA_D1D; ++dx) \
+            for (int dx = 0; dx < MD1; ++dx) \
             { \
-               const int i = qi(qx,dx,DPA_Q1D); \
-               const int j = dj(qx,dx,DPA_D1D); \
-               const int k = qk(qx,dx,DPA_Q1D); \
-               const int l = dl(qx,dx,DPA_D1D); \
+               const int i = qi(qx,dx,MQ1); \
+               const int j = dj(qx,dx,MD1); \
+               const int k = qk(qx,dx,MQ1); \
+               const int l = dl(qx,dx,MD1); \
                const double s = sign(qx,dx); \
                const double coords = s_X[dz][dy][dx]; \
                u += coords * B[i][j]; \
@@ -352,12 +362,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_4 \
    double u = 0.0, v = 0.0, w = 0.0; \
    RAJAPERF_UNROLL(MD1)  \
-   for (int dy = 0; dy < DPA_D1D; ++dy) \
+   for (int dy = 0; dy < MD1; ++dy) \
    { \
-      const int i = qi(qy,dy,DPA_Q1D); \
-      const int j = dj(qy,dy,DPA_D1D); \
-      const int k = qk(qy,dy,DPA_Q1D); \
-      const int l = dl(qy,dy,DPA_D1D); \
+      const int i = qi(qy,dy,MQ1); \
+      const int j = dj(qy,dy,MD1); \
+      const int k = qk(qy,dy,MQ1); \
+      const int l = dl(qy,dy,MD1); \
       const double s = sign(qy,dy); \
       u += DDQ1[dz][dy][qx] * B[i][j]; \
       v += DDQ0[dz][dy][qx] * G[k][l] * s; \
@@ -370,12 +380,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_5 \
                double u = 0.0, v = 0.0, w = 0.0; \
                RAJAPERF_UNROLL(MD1) \
-               for (int dz = 0; dz < DPA_D1D; ++dz) \
+               for (int dz = 0; dz < MD1; ++dz) \
                { \
-                  const int i = qi(qz,dz,DPA_Q1D); \
-                  const int j = dj(qz,dz,DPA_D1D); \
-                  const int k = qk(qz,dz,DPA_Q1D); \
-                  const int l = dl(qz,dz,DPA_D1D); \
+                  const int i = qi(qz,dz,MQ1); \
+                  const int j = dj(qz,dz,MD1); \
+                  const int k = qk(qz,dz,MQ1); \
+                  const int l = dl(qz,dz,MD1); \
                   const double s = sign(qz,dz); \
                   u += DQQ0[dz][qy][qx] * B[i][j]; \
                   v += DQQ1[dz][qy][qx] * B[i][j]; \
@@ -398,22 +408,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
 
 #define DIFFUSION3DPA_6 \
-               const int i = qi(q,d,DPA_Q1D); \
-               const int j = dj(q,d,DPA_D1D); \
-               const int k = qk(q,d,DPA_Q1D); \
-               const int l = dl(q,d,DPA_D1D); \
+               const int i = qi(q,d,MQ1); \
+               const int j = dj(q,d,MD1); \
+               const int k = qk(q,d,MQ1); \
+               const int l = dl(q,d,MD1); \
                Bt[j][i] = b(q,d); \
                Gt[l][k] = g(q,d) * sign(q,d);
 
 #define DIFFUSION3DPA_7 \
             double u = 0.0, v = 0.0, w = 0.0; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qx = 0; qx < DPA_Q1D; ++qx) \
+            for (int qx = 0; qx < MQ1; ++qx) \
             { \
-              const int i = qi(qx,dx,DPA_Q1D); \
-              const int j = dj(qx,dx,DPA_D1D); \
-              const int k = qk(qx,dx,DPA_Q1D); \
-              const int l = dl(qx,dx,DPA_D1D); \
+              const int i = qi(qx,dx,MQ1); \
+              const int j = dj(qx,dx,MD1); \
+              const int k = qk(qx,dx,MQ1); \
+              const int l = dl(qx,dx,MD1); \
               const double s = sign(qx,dx); \
               u += QQQ0[qz][qy][qx] * Gt[l][k] * s; \
               v += QQQ1[qz][qy][qx] * Bt[j][i]; \
@@ -425,13 +435,13 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 
 #define DIFFUSION3DPA_8 \
         double u = 0.0, v = 0.0, w = 0.0; \
-        RAJAPERF_UNROLL(DPA_Q1D)  \
-        for (int qy = 0; qy < DPA_Q1D; ++qy) \
+        RAJAPERF_UNROLL(MQ1)  \
+        for (int qy = 0; qy < MQ1; ++qy) \
         { \
-          const int i = qi(qy,dy,DPA_Q1D); \
-          const int j = dj(qy,dy,DPA_D1D); \
-          const int k = qk(qy,dy,DPA_Q1D); \
-          const int l = dl(qy,dy,DPA_D1D); \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
           const double s = sign(qy,dy); \
           u += QQD0[qz][qy][dx] * Bt[j][i]; \
           v += QQD1[qz][qy][dx] * Gt[l][k] * s; \
@@ -444,12 +454,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_9 \
         double u = 0.0, v = 0.0, w = 0.0; \
         RAJAPERF_UNROLL(MQ1) \
-        for (int qz = 0; qz < DPA_Q1D; ++qz)  \
+        for (int qz = 0; qz < MQ1; ++qz)  \
         {                                     \
-          const int i = qi(qz,dz,DPA_Q1D); \
-          const int j = dj(qz,dz,DPA_D1D); \
-          const int k = qk(qz,dz,DPA_Q1D); \
-          const int l = dl(qz,dz,DPA_D1D); \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
           const double s = sign(qz,dz);    \
           u += QDD0[qz][dy][dx] * Bt[j][i];     \
           v += QDD1[qz][dy][dx] * Bt[j][i];     \
@@ -457,6 +467,263 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         }                                       \
         dpaY_(dx,dy,dz,e) += (u + v + w);
 
+//
+// simd_elements tuning, each contraction is done for a batch of NB elements
+// at a time with the element in the batch as the fastest index of the
+// intermediate arrays
+//
+#define DIFFUSION3DPA_SIMD_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        constexpr int NB = RAJAPERF_PA_SIMD_WIDTH; \
+        const Index_type e0 = eb * NB; \
+        const int nb = (NE - e0 < NB) ? NE - e0 : NB; \
+        double sBG[MQ1*MD1]; \
+        double (*B)[MD1] = (double (*)[MD1]) sBG; \
+        double (*G)[MD1] = (double (*)[MD1]) sBG; \
+        double (*Bt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double (*Gt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double sm0[3][MDQ*MDQ*MDQ*NB]; \
+        double sm1[3][MDQ*MDQ*MDQ*NB]; \
+        double (*s_X)[MD1][MD1][NB]  = (double (*)[MD1][MD1][NB]) (sm0+2); \
+        double (*DDQ0)[MD1][MQ1][NB] = (double (*)[MD1][MQ1][NB]) (sm0+0); \
+        double (*DDQ1)[MD1][MQ1][NB] = (double (*)[MD1][MQ1][NB]) (sm0+1); \
+        double (*DQQ0)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm1+0); \
+        double (*DQQ1)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm1+1); \
+        double (*DQQ2)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm1+2); \
+        double (*QQQ0)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm0+0); \
+        double (*QQQ1)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm0+1); \
+        double (*QQQ2)[MQ1][MQ1][NB] = (double (*)[MQ1][MQ1][NB]) (sm0+2); \
+        double (*QQD0)[MQ1][MD1][NB] = (double (*)[MQ1][MD1][NB]) (sm1+0); \
+        double (*QQD1)[MQ1][MD1][NB] = (double (*)[MQ1][MD1][NB]) (sm1+1); \
+        double (*QQD2)[MQ1][MD1][NB] = (double (*)[MQ1][MD1][NB]) (sm1+2); \
+        double (*QDD0)[MD1][MD1][NB] = (double (*)[MD1][MD1][NB]) (sm0+0); \
+        double (*QDD1)[MD1][MD1][NB] = (double (*)[MD1][MD1][NB]) (sm0+1); \
+        double (*QDD2)[MD1][MD1][NB] = (double (*)[MD1][MD1][NB]) (sm0+2);
+
+#define DIFFUSION3DPA_SIMD_1 \
+        CPU_FOREACH_BATCH(ie) { \
+          s_X[dz][dy][dx][ie] = dpaX_(dx,dy,dz,BATCH_ELEM(ie)); \
+        }
+
+#define DIFFUSION3DPA_SIMD_3 \
+        double u[NB], v[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; } \
+        for (int dx = 0; dx < MD1; ++dx) \
+        { \
+          const int i = qi(qx,dx,MQ1); \
+          const int j = dj(qx,dx,MD1); \
+          const int k = qk(qx,dx,MQ1); \
+          const int l = dl(qx,dx,MD1); \
+          const double s = sign(qx,dx); \
+          const double Bij = B[i][j]; \
+          const double Gkl = G[k][l]; \
+          CPU_FOREACH_BATCH(ie) { \
+            const double coords = s_X[dz][dy][dx][ie]; \
+            u[ie] += coords * Bij; \
+            v[ie] += coords * Gkl * s; \
+          } \
+        } \
+        CPU_FOREACH_BATCH(ie) { \
+          DDQ0[dz][dy][qx][ie] = u[ie]; \
+          DDQ1[dz][dy][qx][ie] = v[ie]; \
+        }
+
+#define DIFFUSION3DPA_SIMD_4 \
+        double u[NB], v[NB], w[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; w[ie] = 0.0; } \
+        for (int dy = 0; dy < MD1; ++dy) \
+        { \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
+          const double s = sign(qy,dy); \
+          const double Bij = B[i][j]; \
+          const double Gkl = G[k][l]; \
+          CPU_FOREACH_BATCH(ie) { \
+            u[ie] += DDQ1[dz][dy][qx][ie] * Bij; \
+            v[ie] += DDQ0[dz][dy][qx][ie] * Gkl * s; \
+            w[ie] += DDQ0[dz][dy][qx][ie] * Bij; \
+          } \
+        } \
+        CPU_FOREACH_BATCH(ie) { \
+          DQQ0[dz][qy][qx][ie] = u[ie]; \
+          DQQ1[dz][qy][qx][ie] = v[ie]; \
+          DQQ2[dz][qy][qx][ie] = w[ie]; \
+        }
+
+#define DIFFUSION3DPA_SIMD_5 \
+        double u[NB], v[NB], w[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; w[ie] = 0.0; } \
+        for (int dz = 0; dz < MD1; ++dz) \
+        { \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
+          const double s = sign(qz,dz); \
+          const double Bij = B[i][j]; \
+          const double Gkl = G[k][l]; \
+          CPU_FOREACH_BATCH(ie) { \
+            u[ie] += DQQ0[dz][qy][qx][ie] * Bij; \
+            v[ie] += DQQ1[dz][qy][qx][ie] * Bij; \
+            w[ie] += DQQ2[dz][qy][qx][ie] * Gkl * s; \
+          } \
+        } \
+        CPU_FOREACH_BATCH(ie) { \
+          const Index_type e = BATCH_ELEM(ie); \
+          const double O11 = d(qx,qy,qz,0,e); \
+          const double O12 = d(qx,qy,qz,1,e); \
+          const double O13 = d(qx,qy,qz,2,e); \
+          const double O21 = symmetric ? O12 : d(qx,qy,qz,3,e); \
+          const double O22 = symmetric ? d(qx,qy,qz,3,e) : d(qx,qy,qz,4,e); \
+          const double O23 = symmetric ? d(qx,qy,qz,4,e) : d(qx,qy,qz,5,e); \
+          const double O31 = symmetric ? O13 : d(qx,qy,qz,6,e); \
+          const double O32 = symmetric ? O23 : d(qx,qy,qz,7,e); \
+          const double O33 = symmetric ? d(qx,qy,qz,5,e) : d(qx,qy,qz,8,e); \
+          const double gX = u[ie]; \
+          const double gY = v[ie]; \
+          const double gZ = w[ie]; \
+          QQQ0[qz][qy][qx][ie] = (O11*gX) + (O12*gY) + (O13*gZ); \
+          QQQ1[qz][qy][qx][ie] = (O21*gX) + (O22*gY) + (O23*gZ); \
+          QQQ2[qz][qy][qx][ie] = (O31*gX) + (O32*gY) + (O33*gZ); \
+        }
+
+#define DIFFUSION3DPA_SIMD_7 \
+        double u[NB], v[NB], w[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; w[ie] = 0.0; } \
+        for (int qx = 0; qx < MQ1; ++qx) \
+        { \
+          const int i = qi(qx,dx,MQ1); \
+          const int j = dj(qx,dx,MD1); \
+          const int k = qk(qx,dx,MQ1); \
+          const int l = dl(qx,dx,MD1); \
+          const double s = sign(qx,dx); \
+          const double Btji = Bt[j][i]; \
+          const double Gtlk = Gt[l][k]; \
+          CPU_FOREACH_BATCH(ie) { \
+            u[ie] += QQQ0[qz][qy][qx][ie] * Gtlk * s; \
+            v[ie] += QQQ1[qz][qy][qx][ie] * Btji; \
+            w[ie] += QQQ2[qz][qy][qx][ie] * Btji; \
+          } \
+        } \
+        CPU_FOREACH_BATCH(ie) { \
+          QQD0[qz][qy][dx][ie] = u[ie]; \
+          QQD1[qz][qy][dx][ie] = v[ie]; \
+          QQD2[qz][qy][dx][ie] = w[ie]; \
+        }
+
+#define DIFFUSION3DPA_SIMD_8 \
+        double u[NB], v[NB], w[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; w[ie] = 0.0; } \
+        for (int qy = 0; qy < MQ1; ++qy) \
+        { \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
+          const double s = sign(qy,dy); \
+          const double Btji = Bt[j][i]; \
+          const double Gtlk = Gt[l][k]; \
+          CPU_FOREACH_BATCH(ie) { \
+            u[ie] += QQD0[qz][qy][dx][ie] * Btji; \
+            v[ie] += QQD1[qz][qy][dx][ie] * Gtlk * s; \
+            w[ie] += QQD2[qz][qy][dx][ie] * Btji; \
+          } \
+        } \
+        CPU_FOREACH_BATCH(ie) { \
+          QDD0[qz][dy][dx][ie] = u[ie]; \
+          QDD1[qz][dy][dx][ie] = v[ie]; \
+          QDD2[qz][dy][dx][ie] = w[ie]; \
+        }
+
+#define DIFFUSION3DPA_SIMD_9 \
+        double u[NB], v[NB], w[NB]; \
+        CPU_FOREACH_BATCH(ie) { u[ie] = 0.0; v[ie] = 0.0; w[ie] = 0.0; } \
+        for (int qz = 0; qz < MQ1; ++qz) \
+        { \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
+          const double s = sign(qz,dz); \
+          const double Btji = Bt[j][i]; \
+          const double Gtlk = Gt[l][k]; \
+          CPU_FOREACH_BATCH(ie) { \
+            u[ie] += QDD0[qz][dy][dx][ie] * Btji; \
+            v[ie] += QDD1[qz][dy][dx][ie] * Btji; \
+            w[ie] += QDD2[qz][dy][dx][ie] * Gtlk * s; \
+          } \
+        } \
+        for (int ie = 0; ie < nb; ++ie) { \
+          dpaY_(dx,dy,dz,(e0 + ie)) += (u[ie] + v[ie] + w[ie]); \
+        }
+
+// batch eb of elements, steps 2 and 6 load the basis as in the default tuning
+#define DIFFUSION3DPA_SIMD_BODY \
+  DIFFUSION3DPA_SIMD_0_CPU \
+  CPU_FOREACH(dz, z, MD1) { \
+    CPU_FOREACH(dy, y, MD1) { \
+      CPU_FOREACH(dx, x, MD1) { \
+        DIFFUSION3DPA_SIMD_1 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dy, y, MD1) { \
+    CPU_FOREACH(qx, x, MQ1) { \
+      DIFFUSION3DPA_2 \
+    } \
+  } \
+  CPU_FOREACH(dz, z, MD1) { \
+    CPU_FOREACH(dy, y, MD1) { \
+      CPU_FOREACH(qx, x, MQ1) { \
+        DIFFUSION3DPA_SIMD_3 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, MD1) { \
+    CPU_FOREACH(qy, y, MQ1) { \
+      CPU_FOREACH(qx, x, MQ1) { \
+        DIFFUSION3DPA_SIMD_4 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(qz, z, MQ1) { \
+    CPU_FOREACH(qy, y, MQ1) { \
+      CPU_FOREACH(qx, x, MQ1) { \
+        DIFFUSION3DPA_SIMD_5 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(d, y, MD1) { \
+    CPU_FOREACH(q, x, MQ1) { \
+      DIFFUSION3DPA_6 \
+    } \
+  } \
+  CPU_FOREACH(qz, z, MQ1) { \
+    CPU_FOREACH(qy, y, MQ1) { \
+      CPU_FOREACH(dx, x, MD1) { \
+        DIFFUSION3DPA_SIMD_7 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(qz, z, MQ1) { \
+    CPU_FOREACH(dy, y, MD1) { \
+      CPU_FOREACH(dx, x, MD1) { \
+        DIFFUSION3DPA_SIMD_8 \
+      } \
+    } \
+  } \
+  CPU_FOREACH(dz, z, MD1) { \
+    CPU_FOREACH(dy, y, MD1) { \
+      CPU_FOREACH(dx, x, MD1) { \
+        DIFFUSION3DPA_SIMD_9 \
+      } \
+    } \
+  }
+
 namespace rajaperf
 {
 class RunParams;
@@ -482,16 +749,27 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantSimdImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantSimdImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = DPA_Q1D * DPA_Q1D * DPA_Q1D;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  using pa_orders_type = camp::int_seq<int, RAJAPERF_PA_ORDERS>;
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -501,6 +779,9 @@ private:
   Real_ptr m_X;
   Real_ptr m_Y;
 
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
   Index_type m_NE;
   Index_type m_NE_default;
 };
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "AppsData.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +20,17 @@ namespace apps
 {
 
 
-void ENERGY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+
+    runOpenMPVariantUnstructured(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -179,8 +188,143 @@ void ENERGY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+void ENERGY::runOpenMPVariantUnstructured(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_UNSTRUCTURED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY1;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY2;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY3;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY4;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY5;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY6;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY1;
+          });
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY2;
+          });
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY3;
+          });
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY4;
+          });
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY5;
+          });
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+            ENERGY_UNSTRUCTURED_BODY_INDEX;
+            ENERGY_BODY6;
+          });
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ENERGY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, getMeshOrderingTuningName(MeshOrdering::Lexicographic));
+    addVariantTuningName(vid, getMeshOrderingTuningName(MeshOrdering::Random));
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
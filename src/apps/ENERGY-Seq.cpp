@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "AppsData.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,15 @@ namespace apps
 {
 
 
-void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx > 0 ) {
+
+    runSeqVariantUnstructured(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -160,5 +169,123 @@ void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void ENERGY::runSeqVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_UNSTRUCTURED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY1;
+        }
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY2;
+        }
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY3;
+        }
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY4;
+        }
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY5;
+        }
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY1;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY2;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY3;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY4;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY5;
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type ii) {
+          ENERGY_UNSTRUCTURED_BODY_INDEX;
+          ENERGY_BODY6;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void ENERGY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, getMeshOrderingTuningName(MeshOrdering::Lexicographic));
+    addVariantTuningName(vid, getMeshOrderingTuningName(MeshOrdering::Random));
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
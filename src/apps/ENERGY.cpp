@@ -10,8 +10,12 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace rajaperf
 {
 namespace apps
@@ -62,13 +66,15 @@ ENERGY::ENERGY(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  m_zone_list = nullptr;
 }
 
 ENERGY::~ENERGY()
 {
 }
 
-void ENERGY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_e_new, getActualProblemSize(), 0.0, vid);
   allocAndInitData(m_e_old, getActualProblemSize(), vid);
@@ -90,6 +96,23 @@ void ENERGY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   initData(m_e_cut);
   initData(m_emin);
   initData(m_q_cut);
+
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == getMeshOrderingTuningName(MeshOrdering::Lexicographic) ||
+       tuning_name == getMeshOrderingTuningName(MeshOrdering::Random) ) {
+
+    std::vector<Index_type> zones(getActualProblemSize());
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      zones[i] = i;
+    }
+    if ( tuning_name == getMeshOrderingTuningName(MeshOrdering::Random) ) {
+      randomShuffle(zones);
+    }
+
+    allocData(m_zone_list, getActualProblemSize());
+    std::copy(zones.begin(), zones.end(), m_zone_list);
+  }
 }
 
 void ENERGY::updateChecksum(VariantID vid, size_t tune_idx)
@@ -117,6 +140,7 @@ void ENERGY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_ql_old);
   deallocData(m_qq_old);
   deallocData(m_vnewc);
+  deallocData(m_zone_list);
 }
 
 } // end namespace apps
@@ -83,6 +83,12 @@
 ///   }
 /// }
 ///
+/// The "unstructured" and "unstructured_random" tunings of the Base and RAJA
+/// host variants loop over an explicit list of zones, i = zone_list[ii], as
+/// done for the zone loops of an unstructured mesh code. The list is in
+/// order or in random order. The zone data is not renumbered so checksums
+/// match the default tuning. Bytes per rep do not include the list.
+///
 
 #ifndef RAJAPerf_Apps_ENERGY_HPP
 #define RAJAPerf_Apps_ENERGY_HPP
@@ -108,6 +114,13 @@
   const Real_type emin = m_emin; \
   const Real_type q_cut = m_q_cut;
 
+#define ENERGY_UNSTRUCTURED_DATA_SETUP \
+  ENERGY_DATA_SETUP \
+  Int_ptr zone_list = m_zone_list;
+
+#define ENERGY_UNSTRUCTURED_BODY_INDEX \
+  Index_type i = zone_list[ii];
+
 #define ENERGY_BODY1 \
   e_new[i] = e_old[i] - 0.5 * delvc[i] * \
              (p_old[i] + q_old[i]) + 0.5 * work[i];
@@ -204,12 +217,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void runSeqVariantUnstructured(VariantID vid);
+  void runOpenMPVariantUnstructured(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -235,6 +252,8 @@ private:
   Real_type m_e_cut;
   Real_type m_emin;
   Real_type m_q_cut;
+
+  Int_ptr m_zone_list;
 };
 
 } // end namespace apps
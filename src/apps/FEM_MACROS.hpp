@@ -26,4 +26,29 @@
 
 #define CPU_FOREACH(i, k, N) for (int i = 0; i < N; i++)
 
+// Polynomial orders the host variants of the partial assembly kernels
+// are compiled for, order p uses p+1 dofs and p+2 quadrature points in 1D.
+// Keep in sync with the --pa-order range checked in RunParams.
+#define RAJAPERF_PA_ORDERS 1, 2, 3, 4, 5, 6, 7, 8
+
+// Number of elements processed together by the simd_elements tunings of the
+// partial assembly kernels, element data is stored with the element in the
+// batch as the fastest index so loops over it vectorize.
+#define RAJAPERF_PA_SIMD_WIDTH 8
+
+#if defined(_OPENMP)
+#define RAJAPERF_PA_SIMD _Pragma("omp simd")
+#else
+#define RAJAPERF_PA_SIMD
+#endif
+
+// Loop over the nb elements of the batch starting at element e0, the loop
+// always runs NB lanes, lanes past the last element load element e0 (see
+// BATCH_ELEM) and their results are never stored.
+#define CPU_FOREACH_BATCH(ie) \
+  RAJAPERF_PA_SIMD            \
+  for (int ie = 0; ie < NB; ++ie)
+
+#define BATCH_ELEM(ie) (((ie) < nb) ? e0 + (ie) : e0)
+
 #endif // closing endif for header file include guard
@@ -10,7 +10,6 @@
 
 #include "RAJA/RAJA.hpp"
 
-#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -19,18 +18,36 @@ namespace apps
 {
 
 
-void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIR::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "unrolled" ) {
+    seq_for(fir_coefflens_type{}, [&](auto coefflen_c) {
+      if ( coefflen_c == m_coefflen ) {
+        runSeqVariantUnrolled<coefflen_c>(vid);
+      }
+    });
+    return;
+  } else if ( host_tuning::run_tuning<host_tuning::unroll, host_unrolls_type>(
+         tuning_name,
+         [&](auto unroll) { runSeqVariantUnroll<unroll>(vid); }) ) {
+    return;
+  } else if ( tuning_name == "register_block" ) {
+    runSeqVariantRegisterBlock(vid);
+    return;
+  } else if ( tuning_name == "fft" ) {
+    runSeqVariantFFT(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize() - m_coefflen;
 
-  FIR_COEFF;
-
   FIR_DATA_SETUP;
 
-  Real_type coeff[FIR_COEFFLEN];
-  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
+  Real_ptr coeff = m_coeff;
 
   auto fir_lam = [=](Index_type i) {
                    FIR_BODY;
@@ -92,5 +109,262 @@ void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < Index_type coefflen_c >
+void FIR::runSeqVariantUnrolled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = m_coeff;
+
+  RAJA_UNUSED_VAR(coefflen);
+
+  auto fir_lam = [=](Index_type i) {
+                   FIR_UNROLLED_BODY(coefflen_c);
+                 };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIR_UNROLLED_BODY(coefflen_c);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), fir_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t unroll_ >
+void FIR::runSeqVariantUnroll(VariantID vid)
+{
+  constexpr Index_type unroll = unroll_;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = m_coeff;
+
+  auto fir_lam = [=](Index_type i) {
+                   FIR_UNROLL_BODY(unroll);
+                 };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIR_UNROLL_BODY(unroll);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), fir_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIR::runSeqVariantRegisterBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = m_coeff;
+
+  const Index_type nblocks = (iend - ibegin) / FIR_BLOCK;
+  const Index_type irem = ibegin + nblocks*FIR_BLOCK;
+
+  auto fir_block_lam = [=](Index_type iblk) {
+                         const Index_type ib = ibegin + iblk*FIR_BLOCK;
+                         FIR_BLOCK_BODY;
+                       };
+
+  auto fir_lam = [=](Index_type i) {
+                   FIR_BODY;
+                 };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type iblk = 0; iblk < nblocks; ++iblk ) {
+          const Index_type ib = ibegin + iblk*FIR_BLOCK;
+          FIR_BLOCK_BODY;
+        }
+
+        for (Index_type i = irem; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), fir_block_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(irem, iend), fir_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIR::runSeqVariantFFT(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  FIR_FFT_DATA_SETUP;
+
+  auto fir_fft_lam = [=](Index_type ip) {
+                       FIR_FFT_BODY;
+                     };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ip = 0; ip < npairs; ++ip ) {
+          FIR_FFT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, npairs), fir_fft_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    if ( hasUnrolledTuning() ) {
+      addVariantTuningName(vid, "unrolled");
+    }
+    addVariantHostTuningNames<host_tuning::unroll, host_unrolls_type>(vid);
+    addVariantTuningName(vid, "register_block");
+    addVariantTuningName(vid, "fft",
+                         FIR_FFT_CHECKSUM_TOLERANCE * m_coefflen);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -12,6 +12,9 @@
 
 #include "common/DataUtils.hpp"
 
+#include <cmath>
+#include <utility>
+
 namespace rajaperf
 {
 namespace apps
@@ -25,6 +28,9 @@ FIR::FIR(const RunParams& params)
   setDefaultReps(160);
 
   m_coefflen = FIR_COEFFLEN;
+  if ( params.getFIRCoeffLen() > 0 ) {
+    m_coefflen = params.getFIRCoeffLen();
+  }
 
   setActualProblemSize( getTargetProblemSize() );
 
@@ -48,24 +54,89 @@ FIR::FIR(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_OpenMPTarget );
-  setVariantDefined( RAJA_OpenMPTarget );
+  // device variants keep the coefficients in a FIR_COEFFLEN array
+  if ( m_coefflen == FIR_COEFFLEN ) {
+
+    setVariantDefined( Base_OpenMPTarget );
+    setVariantDefined( RAJA_OpenMPTarget );
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
+
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
+
+  }
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  m_coeff = nullptr;
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+  m_nfft = 0;
+  m_fft_work = nullptr;
 }
 
 FIR::~FIR()
 {
 }
 
-void FIR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool FIR::hasUnrolledTuning() const
+{
+  bool found = false;
+  seq_for(fir_coefflens_type{}, [&](auto coefflen_c) {
+    if ( coefflen_c == m_coefflen ) {
+      found = true;
+    }
+  });
+  return found;
+}
+
+//
+// FFT length of at least 8 filter lengths so most of each transform
+// produces valid outputs, filter is the transform of the reversed
+// coefficients scaled by 1/nfft so the unscaled inverse gives the outputs.
+//
+void FIR::setUpFFT()
+{
+  m_nfft = 64;
+  while ( m_nfft < 8*m_coefflen ) {
+    m_nfft *= 2;
+  }
+
+  const Index_type nout_fft = m_nfft - m_coefflen + 1;
+  const Index_type npairs = (getActualProblemSize() - m_coefflen + 2*nout_fft - 1) /
+                            (2*nout_fft);
+  allocData(m_fft_work, npairs*m_nfft);
+
+  const Real_type pi = 3.14159265358979323846;
+  m_fft_twiddle.resize(m_nfft/2);
+  m_fft_twiddle_inv.resize(m_nfft/2);
+  for (Index_type k = 0; k < m_nfft/2; ++k) {
+    const Real_type theta = 2.0 * pi * k / m_nfft;
+    m_fft_twiddle[k] = Complex_type(cos(theta), -sin(theta));
+    m_fft_twiddle_inv[k] = Complex_type(cos(theta), sin(theta));
+  }
+
+  m_fft_filter.assign(m_nfft, Complex_type(0.0, 0.0));
+  for (Index_type k = 0; k < m_coefflen; ++k) {
+    m_fft_filter[k] = Complex_type(m_coeff[m_coefflen-1-k] / m_nfft, 0.0);
+  }
+  firFFT(m_fft_filter.data(), m_nfft, m_fft_twiddle.data());
+}
+
+void FIR::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitData(m_in, getActualProblemSize(), vid);
   allocAndInitDataConst(m_out, getActualProblemSize(), 0.0, vid);
+
+  FIR_COEFF;
+
+  allocData(m_coeff, m_coefflen);
+  for (Index_type j = 0; j < m_coefflen; ++j) {
+    m_coeff[j] = coeff_array[j % FIR_COEFFLEN];
+  }
+
+  if ( getVariantTuningName(vid, tune_idx) == "fft" ) {
+    setUpFFT();
+  }
 }
 
 void FIR::updateChecksum(VariantID vid, size_t tune_idx)
@@ -79,6 +150,34 @@ void FIR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   deallocData(m_in);
   deallocData(m_out);
+  deallocData(m_coeff);
+  deallocData(m_fft_work);
+}
+
+void firFFT(Complex_ptr x, Index_type n, const Complex_type* w)
+{
+  for (Index_type i = 1, j = 0; i < n; ++i) {
+    Index_type bit = n >> 1;
+    for ( ; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if ( i < j ) {
+      std::swap(x[i], x[j]);
+    }
+  }
+
+  for (Index_type len = 2; len <= n; len <<= 1) {
+    const Index_type half = len >> 1;
+    const Index_type step = n / len;
+    for (Index_type s = 0; s < n; s += len) {
+      for (Index_type k = 0; k < half; ++k) {
+        const Complex_type t = firComplexMul(w[k*step], x[s+k+half]);
+        x[s+k+half] = x[s+k] - t;
+        x[s+k] += t;
+      }
+    }
+  }
 }
 
 } // end namespace apps
@@ -24,6 +24,21 @@
 ///   out[i] = sum;
 /// }
 ///
+/// The filter length is FIR_COEFFLEN unless --fir-coefflen is given, longer
+/// filters repeat the coefficients above.
+///
+/// Host tunings:
+///   "unrolled"       - coefflen is a template parameter so the inner loop
+///                      has a compile-time trip count, only defined for the
+///                      lengths in RAJAPERF_FIR_COEFFLENS
+///   "unroll_<N>"     - the inner loop is unrolled by N, the taps are summed
+///                      N at a time with a compile-time trip count
+///   "register_block" - each iteration computes FIR_BLOCK outputs keeping a
+///                      sliding window of inputs in registers so each input
+///                      is loaded once per block instead of once per output
+///   "fft"            - overlap-save convolution with radix-2 FFTs of length
+///                      nfft, two real input blocks share one complex FFT
+///
 
 #ifndef RAJAPerf_Apps_FIR_HPP
 #define RAJAPerf_Apps_FIR_HPP
@@ -31,6 +46,18 @@
 
 #define FIR_COEFFLEN (16)
 
+// Filter lengths the "unrolled" tuning is compiled for.
+#define RAJAPERF_FIR_COEFFLENS 4, 8, 16, 32, 64, 128
+
+// Number of outputs computed together by the "register_block" tuning.
+#define FIR_BLOCK (4)
+
+// Relative checksum tolerance of the "fft" tuning per filter coefficient.
+// Its outputs carry rounding errors of the transforms instead of those of
+// the direct sums and the checksum nearly cancels as the coefficients sum
+// to zero, so the tolerance grows with the filter length.
+#define FIR_FFT_CHECKSUM_TOLERANCE (1.0e-10)
+
 #define FIR_DATA_SETUP \
   Real_ptr in = m_in; \
   Real_ptr out = m_out; \
@@ -51,9 +78,91 @@
   } \
   out[i] = sum;
 
+#define FIR_UNROLLED_BODY(coefflen_c) \
+  Real_type sum = 0.0; \
+\
+  for (Index_type j = 0; j < coefflen_c; ++j ) { \
+    sum += coeff[j]*in[i+j]; \
+  } \
+  out[i] = sum;
+
+// taps are summed in the same order as FIR_BODY, unroll at a time and then
+// the remaining coefflen % unroll taps one at a time
+#define FIR_UNROLL_BODY(unroll) \
+  Real_type sum = 0.0; \
+\
+  Index_type j = 0; \
+  for ( ; j + unroll <= coefflen; j += unroll ) { \
+    for (Index_type u = 0; u < unroll; ++u ) { \
+      sum += coeff[j+u]*in[i+j+u]; \
+    } \
+  } \
+  for ( ; j < coefflen; ++j ) { \
+    sum += coeff[j]*in[i+j]; \
+  } \
+  out[i] = sum;
+
+// block of outputs out[ib] to out[ib+FIR_BLOCK-1], win[b] is in[ib+b+j]
+#define FIR_BLOCK_BODY \
+  Real_type sum[FIR_BLOCK]; \
+  Real_type win[FIR_BLOCK]; \
+  for (Index_type b = 0; b < FIR_BLOCK; ++b ) { \
+    sum[b] = 0.0; \
+    win[b] = in[ib+b]; \
+  } \
+\
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    for (Index_type b = 0; b < FIR_BLOCK; ++b ) { \
+      sum[b] += c*win[b]; \
+    } \
+    for (Index_type b = 0; b < FIR_BLOCK-1; ++b ) { \
+      win[b] = win[b+1]; \
+    } \
+    win[FIR_BLOCK-1] = in[ib+j+FIR_BLOCK]; \
+  } \
+\
+  for (Index_type b = 0; b < FIR_BLOCK; ++b ) { \
+    out[ib+b] = sum[b]; \
+  }
+
+#define FIR_FFT_DATA_SETUP \
+  const Index_type nfft = m_nfft; \
+  const Index_type nout_fft = nfft - coefflen + 1; \
+  const Index_type npairs = (iend - ibegin + 2*nout_fft - 1) / (2*nout_fft); \
+  const Index_type len = getActualProblemSize(); \
+  Complex_ptr work = m_fft_work; \
+  const Complex_type* filter = m_fft_filter.data(); \
+  const Complex_type* twiddle = m_fft_twiddle.data(); \
+  const Complex_type* twiddle_inv = m_fft_twiddle_inv.data();
+
+// outputs out[i0] to out[i0+2*nout_fft-1] from input blocks starting at
+// i0 (real part) and i0+nout_fft (imaginary part)
+#define FIR_FFT_BODY \
+  Complex_ptr x = work + ip*nfft; \
+  const Index_type i0 = ibegin + ip*2*nout_fft; \
+  const Index_type i1 = i0 + nout_fft; \
+  for (Index_type n = 0; n < nfft; ++n ) { \
+    x[n] = Complex_type( (i0+n < len) ? in[i0+n] : 0.0, \
+                         (i1+n < len) ? in[i1+n] : 0.0 ); \
+  } \
+\
+  firFFT(x, nfft, twiddle); \
+  for (Index_type n = 0; n < nfft; ++n ) { \
+    x[n] = firComplexMul(x[n], filter[n]); \
+  } \
+  firFFT(x, nfft, twiddle_inv); \
+\
+  for (Index_type n = 0; n < nout_fft; ++n ) { \
+    if ( i0+n < iend ) out[i0+n] = x[coefflen-1+n].real(); \
+    if ( i1+n < iend ) out[i1+n] = x[coefflen-1+n].imag(); \
+  }
+
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -61,6 +170,23 @@ class RunParams;
 namespace apps
 {
 
+//
+// Product of complex numbers without the inf and nan handling of
+// std::complex operator*, which is not inlined by most compilers.
+//
+inline Complex_type firComplexMul(Complex_type a, Complex_type b)
+{
+  return Complex_type(a.real()*b.real() - a.imag()*b.imag(),
+                      a.real()*b.imag() + a.imag()*b.real());
+}
+
+//
+// In place radix-2 FFT of x with length n, a power of two, using the
+// twiddle factors w[k] = exp(-+2 pi i k / n) for k < n/2 for the forward
+// or inverse transform. The inverse is not scaled by 1/n.
+//
+void firFFT(Complex_ptr x, Index_type n, const Complex_type* w);
+
 class FIR : public KernelBase
 {
 public:
@@ -79,8 +205,22 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < Index_type coefflen_c >
+  void runSeqVariantUnrolled(VariantID vid);
+  template < Index_type coefflen_c >
+  void runOpenMPVariantUnrolled(VariantID vid);
+  template < size_t unroll >
+  void runSeqVariantUnroll(VariantID vid);
+  template < size_t unroll >
+  void runOpenMPVariantUnroll(VariantID vid);
+  void runSeqVariantRegisterBlock(VariantID vid);
+  void runOpenMPVariantRegisterBlock(VariantID vid);
+  void runSeqVariantFFT(VariantID vid);
+  void runOpenMPVariantFFT(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -89,11 +229,24 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  using host_unrolls_type = host_tuning::make_list_type<host_tuning::unroll,
+                                                        host_tuning::list_type<4, 8, 16>>;
+  using fir_coefflens_type = camp::int_seq<Index_type, RAJAPERF_FIR_COEFFLENS>;
+
+  bool hasUnrolledTuning() const;
+  void setUpFFT();
 
   Real_ptr m_in;
   Real_ptr m_out;
+  Real_ptr m_coeff;
 
   Index_type m_coefflen;
+
+  Index_type m_nfft;
+  Complex_ptr m_fft_work;
+  std::vector<Complex_type> m_fft_filter;
+  std::vector<Complex_type> m_fft_twiddle;
+  std::vector<Complex_type> m_fft_twiddle_inv;
 };
 
 } // end namespace apps
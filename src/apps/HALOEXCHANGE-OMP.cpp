@@ -18,10 +18,26 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "box" ) {
+    runOpenMPVariantBox(vid);
+    return;
+  } else if ( tuning_name == "rle" ) {
+    runOpenMPVariantRuns(vid);
+    return;
+  }
+  if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                               prefetch_distances_type>(
+         tuning_name,
+         [&](auto distance) { runOpenMPVariantPrefetch<distance>(vid); }) ) {
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   HALOEXCHANGE_DATA_SETUP;
@@ -163,10 +179,380 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void HALOEXCHANGE::runOpenMPVariantBox(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_BOX_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type row = 0; row < box.rows(); ++row) {
+              HALOEXCHANGE_BOX_ROW_SETUP;
+              for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                HALOEXCHANGE_BOX_PACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type row = 0; row < box.rows(); ++row) {
+              HALOEXCHANGE_BOX_ROW_SETUP;
+              for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                HALOEXCHANGE_BOX_UNPACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_PACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_pack_box_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_UNPACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_unpack_box_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE::runOpenMPVariantRuns(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_RUN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; ++r) {
+              HALOEXCHANGE_RUN_SETUP;
+              for (Index_type ii = 0; ii < run_len; ++ii) {
+                HALOEXCHANGE_RUN_PACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; ++r) {
+              HALOEXCHANGE_RUN_SETUP;
+              for (Index_type ii = 0; ii < run_len; ++ii) {
+                HALOEXCHANGE_RUN_UNPACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_PACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_pack_runs_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_UNPACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_unpack_runs_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+template < size_t distance >
+void HALOEXCHANGE::runOpenMPVariantPrefetch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PREFETCH_PACK_BODY(distance);
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PREFETCH_UNPACK_BODY(distance);
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_prefetch_lam = [=](Index_type i) {
+                  HALOEXCHANGE_PREFETCH_PACK_BODY(distance);
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_pack_prefetch_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_prefetch_lam = [=](Index_type i) {
+                  HALOEXCHANGE_PREFETCH_UNPACK_BODY(distance);
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_unpack_prefetch_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "box");
+    setVariantTuningBytesPerRep(vid, "box", m_box_bytes_per_rep);
+    addVariantTuningName(vid, "rle");
+    setVariantTuningBytesPerRep(vid, "rle", m_rle_bytes_per_rep);
+    addVariantTuningName(vid, "sfc_morton");
+    addVariantTuningName(vid, "sfc_hilbert");
+  }
+
+  if ( ( vid == Base_OpenMP || vid == RAJA_OpenMP ) && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
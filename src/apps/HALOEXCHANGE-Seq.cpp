@@ -17,9 +17,50 @@ namespace rajaperf
 namespace apps
 {
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+namespace {
 
-void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+//
+// Index of the neighbor in the opposite direction, see the neighbor
+// order in create_pack_lists.
+//
+Index_type opposite_neighbor(Index_type l)
 {
+  return (l <  6) ? (l ^ 1)
+       : (l < 10) ? 15 - l
+       : (l < 14) ? 23 - l
+       : (l < 18) ? 31 - l
+       :            43 - l;
+}
+
+}
+#endif
+
+
+void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "box" ) {
+    runSeqVariantBox(vid);
+    return;
+  } else if ( tuning_name == "rle" ) {
+    runSeqVariantRuns(vid);
+    return;
+  }
+  if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                               prefetch_distances_type>(
+         tuning_name,
+         [&](auto distance) { runSeqVariantPrefetch<distance>(vid); }) ) {
+    return;
+  }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if ( isMPITuning(vid, tune_idx) ) {
+    runSeqVariantMPI(vid, tuning_name);
+    return;
+  }
+#endif
+
   const Index_type run_reps = getRunReps();
 
   HALOEXCHANGE_DATA_SETUP;
@@ -161,5 +202,524 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+void HALOEXCHANGE::runSeqVariantBox(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_BOX_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type row = 0; row < box.rows(); ++row) {
+              HALOEXCHANGE_BOX_ROW_SETUP;
+              for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                HALOEXCHANGE_BOX_PACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type row = 0; row < box.rows(); ++row) {
+              HALOEXCHANGE_BOX_ROW_SETUP;
+              for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                HALOEXCHANGE_BOX_UNPACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_PACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_pack_box_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_UNPACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_unpack_box_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE::runSeqVariantRuns(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_RUN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type r = 0; r < num_runs; ++r) {
+              HALOEXCHANGE_RUN_SETUP;
+              for (Index_type ii = 0; ii < run_len; ++ii) {
+                HALOEXCHANGE_RUN_PACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type r = 0; r < num_runs; ++r) {
+              HALOEXCHANGE_RUN_SETUP;
+              for (Index_type ii = 0; ii < run_len; ++ii) {
+                HALOEXCHANGE_RUN_UNPACK_BODY;
+              }
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_PACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_pack_runs_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_UNPACK_BODY;
+                  }
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_unpack_runs_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+void HALOEXCHANGE::runSeqVariantMPI(VariantID vid, const std::string& tuning_name)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers;
+  std::vector<int> neighbor_ranks = m_mpi_neighbor_ranks;
+  MPI_Comm comm = m_mpi_comm;
+
+  auto pack = [&](Index_type l) {
+    Real_ptr buffer = buffers[l];
+    Int_ptr list = pack_index_lists[l];
+    Index_type  len  = pack_index_list_lengths[l];
+    for (Index_type v = 0; v < num_vars; ++v) {
+      Real_ptr var = vars[v];
+      for (Index_type i = 0; i < len; i++) {
+        HALOEXCHANGE_PACK_BODY;
+      }
+      buffer += len;
+    }
+  };
+
+  auto unpack = [&](Index_type l) {
+    Real_ptr buffer = recv_buffers[l];
+    Int_ptr list = unpack_index_lists[l];
+    Index_type  len  = unpack_index_list_lengths[l];
+    for (Index_type v = 0; v < num_vars; ++v) {
+      Real_ptr var = vars[v];
+      for (Index_type i = 0; i < len; i++) {
+        HALOEXCHANGE_UNPACK_BODY;
+      }
+      buffer += len;
+    }
+  };
+
+  std::vector<MPI_Request> send_requests(num_neighbors, MPI_REQUEST_NULL);
+  std::vector<MPI_Request> recv_requests(num_neighbors, MPI_REQUEST_NULL);
+
+  auto init_recv = [&](Index_type l, MPI_Request* request) {
+    const int len = num_vars * unpack_index_list_lengths[l];
+    if (tuning_name == "mpi_persistent") {
+      MPI_Recv_init(recv_buffers[l], len, Real_MPI_type,
+                    neighbor_ranks[l], l, comm, request);
+    } else {
+      MPI_Irecv(recv_buffers[l], len, Real_MPI_type,
+                neighbor_ranks[l], l, comm, request);
+    }
+  };
+
+  auto init_send = [&](Index_type l, MPI_Request* request) {
+    const int len = num_vars * pack_index_list_lengths[l];
+    if (tuning_name == "mpi_persistent") {
+      MPI_Send_init(buffers[l], len, Real_MPI_type,
+                    neighbor_ranks[opposite_neighbor(l)], l, comm, request);
+    } else {
+      MPI_Isend(buffers[l], len, Real_MPI_type,
+                neighbor_ranks[opposite_neighbor(l)], l, comm, request);
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      if (tuning_name == "mpi_blocking") {
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            pack(l);
+            MPI_Sendrecv(buffers[l], num_vars * pack_index_list_lengths[l],
+                         Real_MPI_type, neighbor_ranks[opposite_neighbor(l)], l,
+                         recv_buffers[l], num_vars * unpack_index_list_lengths[l],
+                         Real_MPI_type, neighbor_ranks[l], l,
+                         comm, MPI_STATUS_IGNORE);
+            unpack(l);
+          }
+
+        }
+        stopTimer();
+
+      } else if (tuning_name == "mpi_overlap") {
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            init_recv(l, &recv_requests[l]);
+          }
+
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            pack(l);
+            init_send(l, &send_requests[l]);
+          }
+
+          for (Index_type n = 0; n < num_neighbors; ++n) {
+            int l = MPI_UNDEFINED;
+            MPI_Waitany(num_neighbors, recv_requests.data(), &l, MPI_STATUS_IGNORE);
+            unpack(l);
+          }
+
+          MPI_Waitall(num_neighbors, send_requests.data(), MPI_STATUSES_IGNORE);
+
+        }
+        stopTimer();
+
+      } else {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          init_recv(l, &recv_requests[l]);
+          init_send(l, &send_requests[l]);
+        }
+
+        startTimer();
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          MPI_Startall(num_neighbors, recv_requests.data());
+
+          for (Index_type l = 0; l < num_neighbors; ++l) {
+            pack(l);
+            MPI_Start(&send_requests[l]);
+          }
+
+          for (Index_type n = 0; n < num_neighbors; ++n) {
+            int l = MPI_UNDEFINED;
+            // completed persistent requests become inactive and are skipped
+            MPI_Waitany(num_neighbors, recv_requests.data(), &l, MPI_STATUS_IGNORE);
+            unpack(l);
+          }
+
+          MPI_Waitall(num_neighbors, send_requests.data(), MPI_STATUSES_IGNORE);
+
+        }
+        stopTimer();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          MPI_Request_free(&recv_requests[l]);
+          MPI_Request_free(&send_requests[l]);
+        }
+
+      }
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+template < size_t distance >
+void HALOEXCHANGE::runSeqVariantPrefetch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PREFETCH_PACK_BODY(distance);
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PREFETCH_UNPACK_BODY(distance);
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_prefetch_lam = [=](Index_type i) {
+                  HALOEXCHANGE_PREFETCH_PACK_BODY(distance);
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_pack_prefetch_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_prefetch_lam = [=](Index_type i) {
+                  HALOEXCHANGE_PREFETCH_UNPACK_BODY(distance);
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_unpack_prefetch_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "box");
+    setVariantTuningBytesPerRep(vid, "box", m_box_bytes_per_rep);
+    addVariantTuningName(vid, "rle");
+    setVariantTuningBytesPerRep(vid, "rle", m_rle_bytes_per_rep);
+    addVariantTuningName(vid, "sfc_morton");
+    addVariantTuningName(vid, "sfc_hilbert");
+  }
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "mpi_blocking");
+    addVariantTuningName(vid, "mpi_overlap");
+    addVariantTuningName(vid, "mpi_persistent");
+  }
+#endif
+
+  if ( ( vid == Base_Seq || vid == RAJA_Seq ) && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <cmath>
@@ -23,11 +24,13 @@ namespace {
 
 void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                        std::vector<Index_type >& pack_index_list_lengths,
+                       std::vector<HaloBox>& pack_boxes,
                        const Index_type halo_width, const Index_type* grid_dims,
                        const Index_type num_neighbors,
                        VariantID vid);
 void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                          std::vector<Index_type >& unpack_index_list_lengths,
+                         std::vector<HaloBox>& unpack_boxes,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid);
@@ -37,6 +40,13 @@ void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
 void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                           const Index_type num_neighbors,
                           VariantID vid);
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+void create_mpi_neighbors(MPI_Comm& comm,
+                          std::vector<int>& neighbor_ranks,
+                          const Index_type num_neighbors);
+void destroy_mpi_neighbors(MPI_Comm& comm,
+                           std::vector<int>& neighbor_ranks);
+#endif
 
 }
 
@@ -80,6 +90,10 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
   setFLOPsPerRep(0);
 
+  m_box_bytes_per_rep = get_box_bytes_per_rep(getItsPerRep());
+  m_rle_bytes_per_rep = get_rle_bytes_per_rep(getItsPerRep(),
+      m_num_vars * get_num_halo_runs(m_halo_width, m_grid_dims));
+
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
@@ -104,7 +118,63 @@ HALOEXCHANGE::~HALOEXCHANGE()
 {
 }
 
-void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool HALOEXCHANGE::isSfcTuning(VariantID vid, size_t tune_idx) const
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  return tuning_name == "sfc_morton" || tuning_name == "sfc_hilbert";
+}
+
+//
+// Store the cells of each variable along the space-filling curve of the
+// "sfc_morton" or "sfc_hilbert" tuning, cell s of a variable holds the
+// value of grid index m_sfc_order[s], and map the index lists to the
+// positions of their grid indices.
+//
+void HALOEXCHANGE::setUpSfcOrder(const std::string& tuning_name)
+{
+  std::vector<Index_type> grid_indices(m_var_size);
+  for (Index_type i = 0; i < m_var_size; ++i) {
+    grid_indices[i] = i;
+  }
+  setSpaceFillingCurveOrder(m_sfc_order, grid_indices.data(), m_var_size,
+                            m_grid_plus_halo_dims[0],
+                            m_grid_plus_halo_dims[0] * m_grid_plus_halo_dims[1],
+                            (tuning_name == "sfc_morton")
+                              ? MeshOrdering::Morton : MeshOrdering::Hilbert);
+
+  std::vector<Index_type> sfc_pos(m_var_size);
+  for (Index_type s = 0; s < m_var_size; ++s) {
+    sfc_pos[m_sfc_order[s]] = s;
+  }
+
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    Real_ptr var = m_vars[v];
+    for (Index_type s = 0; s < m_var_size; ++s) {
+      var[s] = m_sfc_order[s] + v;
+    }
+  }
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Int_ptr pack_list = m_pack_index_lists[l];
+    for (Index_type i = 0; i < m_pack_index_list_lengths[l]; ++i) {
+      pack_list[i] = sfc_pos[pack_list[i]];
+    }
+    Int_ptr unpack_list = m_unpack_index_lists[l];
+    for (Index_type i = 0; i < m_unpack_index_list_lengths[l]; ++i) {
+      unpack_list[i] = sfc_pos[unpack_list[i]];
+    }
+  }
+}
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+bool HALOEXCHANGE::isMPITuning(VariantID vid, size_t tune_idx) const
+{
+  return vid == Base_Seq &&
+         getVariantTuningName(vid, tune_idx).compare(0, 4, "mpi_") == 0;
+}
+#endif
+
+void HALOEXCHANGE::setUp(VariantID vid, size_t tune_idx)
 {
   m_vars.resize(m_num_vars, nullptr);
   for (Index_type v = 0; v < m_num_vars; ++v) {
@@ -119,33 +189,89 @@ void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   m_pack_index_lists.resize(s_num_neighbors, nullptr);
   m_pack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_pack_boxes, m_halo_width, m_grid_dims, s_num_neighbors, vid);
 
   m_unpack_index_lists.resize(s_num_neighbors, nullptr);
   m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_unpack_boxes, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  if ( isSfcTuning(vid, tune_idx) ) {
+    setUpSfcOrder(getVariantTuningName(vid, tune_idx));
+  }
+
+  create_runs(m_pack_index_lists, m_pack_index_list_lengths,
+              m_pack_run_starts, m_pack_run_offsets, m_pack_num_runs, vid);
+  create_runs(m_unpack_index_lists, m_unpack_index_list_lengths,
+              m_unpack_run_starts, m_unpack_run_offsets, m_unpack_num_runs, vid);
 
   m_buffers.resize(s_num_neighbors, nullptr);
   for (Index_type l = 0; l < s_num_neighbors; ++l) {
     Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
     allocAndInitData(m_buffers[l], buffer_len, vid);
   }
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if ( isMPITuning(vid, tune_idx) ) {
+    create_mpi_neighbors(m_mpi_comm, m_mpi_neighbor_ranks, s_num_neighbors);
+
+    m_recv_buffers.resize(s_num_neighbors, nullptr);
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      Index_type buffer_len = m_num_vars * m_unpack_index_list_lengths[l];
+      allocAndInitData(m_recv_buffers[l], buffer_len, vid);
+    }
+  }
+#else
+  (void) tune_idx;
+#endif
 }
 
 void HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( isSfcTuning(vid, tune_idx) ) {
+    // checksum the variables in grid order
+    std::vector<Real_type> grid_var(m_var_size);
+    for (Real_ptr var : m_vars) {
+      for (Index_type s = 0; s < m_var_size; ++s) {
+        grid_var[m_sfc_order[s]] = var[s];
+      }
+      checksum[vid][tune_idx] += calcChecksum(grid_var.data(), m_var_size);
+    }
+    return;
+  }
+
   for (Real_ptr var : m_vars) {
     checksum[vid][tune_idx] += calcChecksum(var, m_var_size);
   }
 }
 
-void HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::tearDown(VariantID vid, size_t tune_idx)
 {
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if ( isMPITuning(vid, tune_idx) ) {
+    for (int l = 0; l < s_num_neighbors; ++l) {
+      deallocData(m_recv_buffers[l]);
+    }
+    m_recv_buffers.clear();
+
+    destroy_mpi_neighbors(m_mpi_comm, m_mpi_neighbor_ranks);
+  }
+#else
+  (void) tune_idx;
+#endif
+
   for (int l = 0; l < s_num_neighbors; ++l) {
     deallocData(m_buffers[l]);
   }
   m_buffers.clear();
 
+  std::vector<Index_type>().swap(m_sfc_order);
+
+  destroy_runs(m_unpack_run_starts, m_unpack_run_offsets, m_unpack_num_runs, vid);
+  destroy_runs(m_pack_run_starts, m_pack_run_offsets, m_pack_num_runs, vid);
+
+  m_unpack_boxes.clear();
+  m_pack_boxes.clear();
+
   destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
   m_unpack_index_list_lengths.clear();
   m_unpack_index_lists.clear();
@@ -177,11 +303,13 @@ struct Extent
 //
 void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                        std::vector<Index_type >& pack_index_list_lengths,
+                       std::vector<HaloBox>& pack_boxes,
                        const Index_type halo_width, const Index_type* grid_dims,
                        const Index_type num_neighbors,
                        VariantID vid)
 {
   std::vector<Extent> pack_index_list_extents(num_neighbors);
+  pack_boxes.resize(num_neighbors);
 
   // faces
   pack_index_list_extents[0]  = Extent{halo_width  , halo_width   + halo_width,
@@ -279,6 +407,14 @@ void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                                  (extent.j_max - extent.j_min) *
                                  (extent.k_max - extent.k_min) ;
 
+    pack_boxes[l] = HaloBox{extent.i_min * grid_i_stride +
+                            extent.j_min * grid_j_stride +
+                            extent.k_min * grid_k_stride,
+                            extent.i_max - extent.i_min,
+                            extent.j_max - extent.j_min,
+                            extent.k_max - extent.k_min,
+                            grid_j_stride, grid_k_stride};
+
     allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
 
     Int_ptr pack_list = pack_index_lists[l];
@@ -320,11 +456,13 @@ void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
 //
 void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                          std::vector<Index_type >& unpack_index_list_lengths,
+                         std::vector<HaloBox>& unpack_boxes,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid)
 {
   std::vector<Extent> unpack_index_list_extents(num_neighbors);
+  unpack_boxes.resize(num_neighbors);
 
   // faces
   unpack_index_list_extents[0]  = Extent{0                        ,                  halo_width,
@@ -422,6 +560,14 @@ void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                                    (extent.j_max - extent.j_min) *
                                    (extent.k_max - extent.k_min) ;
 
+    unpack_boxes[l] = HaloBox{extent.i_min * grid_i_stride +
+                              extent.j_min * grid_j_stride +
+                              extent.k_min * grid_k_stride,
+                              extent.i_max - extent.i_min,
+                              extent.j_max - extent.j_min,
+                              extent.k_max - extent.k_min,
+                              grid_j_stride, grid_k_stride};
+
     allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
 
     Int_ptr unpack_list = unpack_index_lists[l];
@@ -458,6 +604,63 @@ void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
   }
 }
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+//
+// Function to create a periodic 3D process grid and find the rank of each
+// neighbor, directions are in the order of the index lists.
+//
+void create_mpi_neighbors(MPI_Comm& comm,
+                          std::vector<int>& neighbor_ranks,
+                          const Index_type num_neighbors)
+{
+  static const int directions[26][3] = {
+    // faces
+    {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0}, { 0,  1,  0},
+    { 0,  0, -1}, { 0,  0,  1},
+    // edges
+    {-1, -1,  0}, {-1,  1,  0}, { 1, -1,  0}, { 1,  1,  0},
+    {-1,  0, -1}, {-1,  0,  1}, { 1,  0, -1}, { 1,  0,  1},
+    { 0, -1, -1}, { 0, -1,  1}, { 0,  1, -1}, { 0,  1,  1},
+    // corners
+    {-1, -1, -1}, {-1, -1,  1}, {-1,  1, -1}, {-1,  1,  1},
+    { 1, -1, -1}, { 1, -1,  1}, { 1,  1, -1}, { 1,  1,  1} };
+
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  int dims[3] = {0, 0, 0};
+  MPI_Dims_create(num_ranks, 3, dims);
+
+  int periods[3] = {1, 1, 1};
+  MPI_Cart_create(MPI_COMM_WORLD, 3, dims, periods, /*reorder*/ 0, &comm);
+
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  int coords[3];
+  MPI_Cart_coords(comm, rank, 3, coords);
+
+  neighbor_ranks.resize(num_neighbors, MPI_PROC_NULL);
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    int neighbor_coords[3];
+    for (int d = 0; d < 3; ++d) {
+      neighbor_coords[d] = (coords[d] + directions[l][d] + dims[d]) % dims[d];
+    }
+    MPI_Cart_rank(comm, neighbor_coords, &neighbor_ranks[l]);
+  }
+}
+
+//
+// Function to destroy the process grid.
+//
+void destroy_mpi_neighbors(MPI_Comm& comm,
+                           std::vector<int>& neighbor_ranks)
+{
+  neighbor_ranks.clear();
+  MPI_Comm_free(&comm);
+}
+#endif
+
 } // end namespace
 
 } // end namespace apps
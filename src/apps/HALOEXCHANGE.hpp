@@ -41,6 +41,32 @@
 ///   }
 /// }
 ///
+/// The Base and RAJA host variants have "box" and "rle" tunings that
+/// describe the halo regions as boxes or run-length encoded index lists
+/// instead of index lists, see HALOEXCHANGE_PACKING.hpp.
+///
+/// They also have "sfc_morton" and "sfc_hilbert" tunings that run the
+/// default loops with the cells of each variable stored along the Morton or
+/// Hilbert space-filling curve and the index lists mapped to those
+/// positions, see setSpaceFillingCurveOrder in AppsData.hpp.
+///
+/// The "prefetch_<N>" tunings of the Base and RAJA host variants prefetch
+/// the variable element packed or unpacked N iterations ahead through the
+/// index list, see the prefetch namespace in HostUtils.hpp.
+///
+/// When built with MPI the Base_Seq variant also has tunings that send the
+/// packed buffers to the neighboring ranks of a periodic 3D process grid:
+///
+///  "mpi_blocking"   pack, MPI_Sendrecv, and unpack one neighbor at a time
+///  "mpi_overlap"    post all receives, send each buffer as soon as it is
+///                   packed, and unpack each buffer as soon as it arrives
+///  "mpi_persistent" like "mpi_overlap" using persistent requests created
+///                   before the timed loop
+///
+/// Buffer l is sent to the neighbor in the direction opposite to neighbor l
+/// and received from neighbor l. Every rank holds the same data, so the
+/// unpacked values and checksums match the single process tunings.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
@@ -62,8 +88,21 @@
 #define HALOEXCHANGE_UNPACK_BODY \
   var[list[i]] = buffer[i];
 
+#define HALOEXCHANGE_PREFETCH_PACK_BODY(distance) \
+  if (i + distance < len) { \
+    prefetch::read(&var[list[i + distance]]); \
+  } \
+  HALOEXCHANGE_PACK_BODY
+
+#define HALOEXCHANGE_PREFETCH_UNPACK_BODY(distance) \
+  if (i + distance < len) { \
+    prefetch::write(&var[list[i + distance]]); \
+  } \
+  HALOEXCHANGE_UNPACK_BODY
+
 
 #include "common/KernelBase.hpp"
+#include "HALOEXCHANGE_PACKING.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -94,8 +133,21 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantBox(VariantID vid);
+  void runSeqVariantRuns(VariantID vid);
+  void runOpenMPVariantBox(VariantID vid);
+  void runOpenMPVariantRuns(VariantID vid);
+  template < size_t distance >
+  void runSeqVariantPrefetch(VariantID vid);
+  template < size_t distance >
+  void runOpenMPVariantPrefetch(VariantID vid);
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  void runSeqVariantMPI(VariantID vid, const std::string& tuning_name);
+#endif
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -104,6 +156,8 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+  using prefetch_distances_type = host_tuning::make_list_type<host_tuning::prefetch_distance,
+                                                              host_tuning::list_type<8, 32, 128>>;
 
   static const int s_num_neighbors = 26;
 
@@ -115,6 +169,9 @@ private:
   Index_type m_halo_width_default;
   Index_type m_num_vars_default;
 
+  Index_type m_box_bytes_per_rep;
+  Index_type m_rle_bytes_per_rep;
+
   Index_type m_grid_plus_halo_dims[3];
   Index_type m_var_size;
   Index_type m_var_halo_size;
@@ -126,6 +183,29 @@ private:
   std::vector<Index_type > m_pack_index_list_lengths;
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
+
+  std::vector<HaloBox> m_pack_boxes;
+  std::vector<HaloBox> m_unpack_boxes;
+
+  std::vector<Int_ptr> m_pack_run_starts;
+  std::vector<Int_ptr> m_pack_run_offsets;
+  std::vector<Index_type> m_pack_num_runs;
+  std::vector<Int_ptr> m_unpack_run_starts;
+  std::vector<Int_ptr> m_unpack_run_offsets;
+  std::vector<Index_type> m_unpack_num_runs;
+
+  bool isSfcTuning(VariantID vid, size_t tune_idx) const;
+  void setUpSfcOrder(const std::string& tuning_name);
+
+  std::vector<Index_type> m_sfc_order;
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  bool isMPITuning(VariantID vid, size_t tune_idx) const;
+
+  MPI_Comm m_mpi_comm;
+  std::vector<int> m_mpi_neighbor_ranks;
+  std::vector<Real_ptr> m_recv_buffers;
+#endif
 };
 
 } // end namespace apps
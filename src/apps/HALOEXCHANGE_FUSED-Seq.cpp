@@ -18,8 +18,18 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "box" ) {
+    runSeqVariantBox(vid);
+    return;
+  } else if ( tuning_name == "rle" ) {
+    runSeqVariantRuns(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   HALOEXCHANGE_FUSED_DATA_SETUP;
@@ -236,5 +246,365 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
 }
 
+void HALOEXCHANGE_FUSED::runSeqVariantBox(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+  HALOEXCHANGE_BOX_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      HALOEXCHANGE_FUSED_MANUAL_BOX_FUSER_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type pack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            pack_box_holders[pack_index] = box_holder{buffer, var, box};
+            pack_index += 1;
+            buffer += len;
+          }
+        }
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr buffer = pack_box_holders[j].buffer;
+          Real_ptr var    = pack_box_holders[j].var;
+          HaloBox  box    = pack_box_holders[j].box;
+          for (Index_type row = 0; row < box.rows(); ++row) {
+            HALOEXCHANGE_BOX_ROW_SETUP;
+            for (Index_type ii = 0; ii < box.len_i; ++ii) {
+              HALOEXCHANGE_BOX_PACK_BODY;
+            }
+          }
+        }
+
+        Index_type unpack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            unpack_box_holders[unpack_index] = box_holder{buffer, var, box};
+            unpack_index += 1;
+            buffer += len;
+          }
+        }
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr buffer = unpack_box_holders[j].buffer;
+          Real_ptr var    = unpack_box_holders[j].var;
+          HaloBox  box    = unpack_box_holders[j].box;
+          for (Index_type row = 0; row < box.rows(); ++row) {
+            HALOEXCHANGE_BOX_ROW_SETUP;
+            for (Index_type ii = 0; ii < box.len_i; ++ii) {
+              HALOEXCHANGE_BOX_UNPACK_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_BOX_FUSER_TEARDOWN;
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::loop_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+      pool_unpack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = pack_boxes[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_fused_pack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_PACK_BODY;
+                  }
+                };
+            pool_pack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_fused_pack_box_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_pack = pool_pack.instantiate();
+        worksite site_pack = group_pack.run();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          HaloBox box = unpack_boxes[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_fused_unpack_box_lam = [=](Index_type row) {
+                  HALOEXCHANGE_BOX_ROW_SETUP;
+                  for (Index_type ii = 0; ii < box.len_i; ++ii) {
+                    HALOEXCHANGE_BOX_UNPACK_BODY;
+                  }
+                };
+            pool_unpack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, box.rows()),
+                haloexchange_fused_unpack_box_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_unpack = pool_unpack.instantiate();
+        worksite site_unpack = group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE_FUSED::runSeqVariantRuns(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+  HALOEXCHANGE_RUN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      HALOEXCHANGE_FUSED_MANUAL_RUN_FUSER_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type pack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            pack_run_holders[pack_index] = run_holder{buffer, var, run_starts, run_offsets, num_runs};
+            pack_index += 1;
+            buffer += len;
+          }
+        }
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr   buffer      = pack_run_holders[j].buffer;
+          Real_ptr   var         = pack_run_holders[j].var;
+          Int_ptr    run_starts  = pack_run_holders[j].run_starts;
+          Int_ptr    run_offsets = pack_run_holders[j].run_offsets;
+          Index_type num_runs    = pack_run_holders[j].num_runs;
+          for (Index_type r = 0; r < num_runs; ++r) {
+            HALOEXCHANGE_RUN_SETUP;
+            for (Index_type ii = 0; ii < run_len; ++ii) {
+              HALOEXCHANGE_RUN_PACK_BODY;
+            }
+          }
+        }
+
+        Index_type unpack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            unpack_run_holders[unpack_index] = run_holder{buffer, var, run_starts, run_offsets, num_runs};
+            unpack_index += 1;
+            buffer += len;
+          }
+        }
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr   buffer      = unpack_run_holders[j].buffer;
+          Real_ptr   var         = unpack_run_holders[j].var;
+          Int_ptr    run_starts  = unpack_run_holders[j].run_starts;
+          Int_ptr    run_offsets = unpack_run_holders[j].run_offsets;
+          Index_type num_runs    = unpack_run_holders[j].num_runs;
+          for (Index_type r = 0; r < num_runs; ++r) {
+            HALOEXCHANGE_RUN_SETUP;
+            for (Index_type ii = 0; ii < run_len; ++ii) {
+              HALOEXCHANGE_RUN_UNPACK_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_RUN_FUSER_TEARDOWN;
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::loop_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+      pool_unpack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = pack_run_starts[l];
+          Int_ptr run_offsets = pack_run_offsets[l];
+          Index_type num_runs = pack_num_runs[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_fused_pack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_PACK_BODY;
+                  }
+                };
+            pool_pack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_fused_pack_runs_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_pack = pool_pack.instantiate();
+        worksite site_pack = group_pack.run();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr run_starts = unpack_run_starts[l];
+          Int_ptr run_offsets = unpack_run_offsets[l];
+          Index_type num_runs = unpack_num_runs[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_fused_unpack_runs_lam = [=](Index_type r) {
+                  HALOEXCHANGE_RUN_SETUP;
+                  for (Index_type ii = 0; ii < run_len; ++ii) {
+                    HALOEXCHANGE_RUN_UNPACK_BODY;
+                  }
+                };
+            pool_unpack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_fused_unpack_runs_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_unpack = pool_unpack.instantiate();
+        worksite site_unpack = group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE_FUSED::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "box");
+    setVariantTuningBytesPerRep(vid, "box", m_box_bytes_per_rep);
+    addVariantTuningName(vid, "rle");
+    setVariantTuningBytesPerRep(vid, "rle", m_rle_bytes_per_rep);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
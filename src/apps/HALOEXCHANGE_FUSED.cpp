@@ -23,11 +23,13 @@ namespace {
 
 void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                        std::vector<Index_type >& pack_index_list_lengths,
+                       std::vector<HaloBox>& pack_boxes,
                        const Index_type halo_width, const Index_type* grid_dims,
                        const Index_type num_neighbors,
                        VariantID vid);
 void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                          std::vector<Index_type >& unpack_index_list_lengths,
+                         std::vector<HaloBox>& unpack_boxes,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid);
@@ -80,6 +82,10 @@ HALOEXCHANGE_FUSED::HALOEXCHANGE_FUSED(const RunParams& params)
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
   setFLOPsPerRep(0);
 
+  m_box_bytes_per_rep = get_box_bytes_per_rep(getItsPerRep());
+  m_rle_bytes_per_rep = get_rle_bytes_per_rep(getItsPerRep(),
+      m_num_vars * get_num_halo_runs(m_halo_width, m_grid_dims));
+
   setUsesFeature(Workgroup);
 
   setVariantDefined( Base_Seq );
@@ -119,11 +125,16 @@ void HALOEXCHANGE_FUSED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
   m_pack_index_lists.resize(s_num_neighbors, nullptr);
   m_pack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_pack_boxes, m_halo_width, m_grid_dims, s_num_neighbors, vid);
 
   m_unpack_index_lists.resize(s_num_neighbors, nullptr);
   m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_unpack_boxes, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  create_runs(m_pack_index_lists, m_pack_index_list_lengths,
+              m_pack_run_starts, m_pack_run_offsets, m_pack_num_runs, vid);
+  create_runs(m_unpack_index_lists, m_unpack_index_list_lengths,
+              m_unpack_run_starts, m_unpack_run_offsets, m_unpack_num_runs, vid);
 
   m_buffers.resize(s_num_neighbors, nullptr);
   for (Index_type l = 0; l < s_num_neighbors; ++l) {
@@ -146,6 +157,12 @@ void HALOEXCHANGE_FUSED::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
   }
   m_buffers.clear();
 
+  destroy_runs(m_unpack_run_starts, m_unpack_run_offsets, m_unpack_num_runs, vid);
+  destroy_runs(m_pack_run_starts, m_pack_run_offsets, m_pack_num_runs, vid);
+
+  m_unpack_boxes.clear();
+  m_pack_boxes.clear();
+
   destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
   m_unpack_index_list_lengths.clear();
   m_unpack_index_lists.clear();
@@ -177,11 +194,13 @@ struct Extent
 //
 void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                        std::vector<Index_type >& pack_index_list_lengths,
+                       std::vector<HaloBox>& pack_boxes,
                        const Index_type halo_width, const Index_type* grid_dims,
                        const Index_type num_neighbors,
                        VariantID vid)
 {
   std::vector<Extent> pack_index_list_extents(num_neighbors);
+  pack_boxes.resize(num_neighbors);
 
   // faces
   pack_index_list_extents[0]  = Extent{halo_width  , halo_width   + halo_width,
@@ -279,6 +298,14 @@ void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
                                  (extent.j_max - extent.j_min) *
                                  (extent.k_max - extent.k_min) ;
 
+    pack_boxes[l] = HaloBox{extent.i_min * grid_i_stride +
+                            extent.j_min * grid_j_stride +
+                            extent.k_min * grid_k_stride,
+                            extent.i_max - extent.i_min,
+                            extent.j_max - extent.j_min,
+                            extent.k_max - extent.k_min,
+                            grid_j_stride, grid_k_stride};
+
     allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
 
     Int_ptr pack_list = pack_index_lists[l];
@@ -320,11 +347,13 @@ void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
 //
 void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                          std::vector<Index_type >& unpack_index_list_lengths,
+                         std::vector<HaloBox>& unpack_boxes,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid)
 {
   std::vector<Extent> unpack_index_list_extents(num_neighbors);
+  unpack_boxes.resize(num_neighbors);
 
   // faces
   unpack_index_list_extents[0]  = Extent{0                        ,                  halo_width,
@@ -422,6 +451,14 @@ void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                                    (extent.j_max - extent.j_min) *
                                    (extent.k_max - extent.k_min) ;
 
+    unpack_boxes[l] = HaloBox{extent.i_min * grid_i_stride +
+                              extent.j_min * grid_j_stride +
+                              extent.k_min * grid_k_stride,
+                              extent.i_max - extent.i_min,
+                              extent.j_max - extent.j_min,
+                              extent.k_max - extent.k_min,
+                              grid_j_stride, grid_k_stride};
+
     allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
 
     Int_ptr unpack_list = unpack_index_lists[l];
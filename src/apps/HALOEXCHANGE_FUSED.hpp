@@ -41,6 +41,10 @@
 ///   }
 /// }
 ///
+/// The Base and RAJA host variants have "box" and "rle" tunings that
+/// describe the halo regions as boxes or run-length encoded index lists
+/// instead of index lists, see HALOEXCHANGE_PACKING.hpp.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
@@ -73,6 +77,34 @@
   delete[] unpack_ptr_holders; \
   delete[] unpack_lens;
 
+#define HALOEXCHANGE_FUSED_MANUAL_BOX_FUSER_SETUP \
+  struct box_holder { \
+    Real_ptr buffer; \
+    Real_ptr var; \
+    HaloBox  box; \
+  }; \
+  box_holder* pack_box_holders   = new box_holder[num_neighbors * num_vars]; \
+  box_holder* unpack_box_holders = new box_holder[num_neighbors * num_vars];
+
+#define HALOEXCHANGE_FUSED_MANUAL_BOX_FUSER_TEARDOWN \
+  delete[] pack_box_holders; \
+  delete[] unpack_box_holders;
+
+#define HALOEXCHANGE_FUSED_MANUAL_RUN_FUSER_SETUP \
+  struct run_holder { \
+    Real_ptr   buffer; \
+    Real_ptr   var; \
+    Int_ptr    run_starts; \
+    Int_ptr    run_offsets; \
+    Index_type num_runs; \
+  }; \
+  run_holder* pack_run_holders   = new run_holder[num_neighbors * num_vars]; \
+  run_holder* unpack_run_holders = new run_holder[num_neighbors * num_vars];
+
+#define HALOEXCHANGE_FUSED_MANUAL_RUN_FUSER_TEARDOWN \
+  delete[] pack_run_holders; \
+  delete[] unpack_run_holders;
+
 #define HALOEXCHANGE_FUSED_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -108,6 +140,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "HALOEXCHANGE_PACKING.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -138,8 +171,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantBox(VariantID vid);
+  void runSeqVariantRuns(VariantID vid);
+  void runOpenMPVariantBox(VariantID vid);
+  void runOpenMPVariantRuns(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -159,6 +198,9 @@ private:
   Index_type m_halo_width_default;
   Index_type m_num_vars_default;
 
+  Index_type m_box_bytes_per_rep;
+  Index_type m_rle_bytes_per_rep;
+
   Index_type m_grid_plus_halo_dims[3];
   Index_type m_var_size;
   Index_type m_var_halo_size;
@@ -170,6 +212,16 @@ private:
   std::vector<Index_type > m_pack_index_list_lengths;
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
+
+  std::vector<HaloBox> m_pack_boxes;
+  std::vector<HaloBox> m_unpack_boxes;
+
+  std::vector<Int_ptr> m_pack_run_starts;
+  std::vector<Int_ptr> m_pack_run_offsets;
+  std::vector<Index_type> m_pack_num_runs;
+  std::vector<Int_ptr> m_unpack_run_starts;
+  std::vector<Int_ptr> m_unpack_run_offsets;
+  std::vector<Index_type> m_unpack_num_runs;
 };
 
 } // end namespace apps
@@ -0,0 +1,217 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Alternate descriptions of the halo regions used by the "box" and "rle"
+/// tunings of the HALOEXCHANGE and HALOEXCHANGE_FUSED kernels.
+///
+/// Each of the 26 neighbor regions is a 3D box of the grid, so instead of
+/// an index list it can be described by the offset of its first element,
+/// its extents, and the grid strides. The box is packed row by row, the
+/// i index is stride one in the grid and the buffer:
+///
+/// for (Index_type row = 0; row < box.len_j * box.len_k; ++row) {
+///   HALOEXCHANGE_BOX_ROW_SETUP;
+///   for (Index_type ii = 0; ii < box.len_i; ++ii) {
+///     HALOEXCHANGE_BOX_PACK_BODY;
+///   }
+/// }
+///
+/// The run-length encoded description compresses an index list into runs
+/// of consecutive indices, each run has a start index in the grid and an
+/// offset in the buffer (run_offsets has num_runs+1 entries):
+///
+/// for (Index_type r = 0; r < num_runs; ++r) {
+///   HALOEXCHANGE_RUN_SETUP;
+///   for (Index_type ii = 0; ii < run_len; ++ii) {
+///     HALOEXCHANGE_RUN_PACK_BODY;
+///   }
+/// }
+///
+/// Bytes moved per rep, n = number of halo values packed (and unpacked)
+/// per rep over all variables, nr = number of runs over all neighbors
+/// and variables:
+///
+///   index lists : 2 * n * (2*sizeof(Real_type) + sizeof(Int_type))
+///   box         : 2 * n * (2*sizeof(Real_type))
+///   rle         : 2 * n * (2*sizeof(Real_type)) + 2 * nr * 2*sizeof(Int_type)
+///
+/// The box and rle bytes are reported per tuning, see
+/// get_box_bytes_per_rep and get_rle_bytes_per_rep.
+///
+
+#ifndef RAJAPerf_Apps_HALOEXCHANGE_PACKING_HPP
+#define RAJAPerf_Apps_HALOEXCHANGE_PACKING_HPP
+
+#define HALOEXCHANGE_BOX_DATA_SETUP \
+  std::vector<HaloBox> pack_boxes = m_pack_boxes; \
+  std::vector<HaloBox> unpack_boxes = m_unpack_boxes;
+
+#define HALOEXCHANGE_RUN_DATA_SETUP \
+  std::vector<Int_ptr> pack_run_starts = m_pack_run_starts; \
+  std::vector<Int_ptr> pack_run_offsets = m_pack_run_offsets; \
+  std::vector<Index_type> pack_num_runs = m_pack_num_runs; \
+  std::vector<Int_ptr> unpack_run_starts = m_unpack_run_starts; \
+  std::vector<Int_ptr> unpack_run_offsets = m_unpack_run_offsets; \
+  std::vector<Index_type> unpack_num_runs = m_unpack_num_runs;
+
+#define HALOEXCHANGE_BOX_ROW_SETUP \
+  const Index_type kk = row / box.len_j; \
+  const Index_type jj = row - kk * box.len_j; \
+  Real_ptr var_row = var + box.offset + jj * box.stride_j + kk * box.stride_k; \
+  Real_ptr buffer_row = buffer + row * box.len_i;
+
+#define HALOEXCHANGE_BOX_PACK_BODY \
+  buffer_row[ii] = var_row[ii];
+
+#define HALOEXCHANGE_BOX_UNPACK_BODY \
+  var_row[ii] = buffer_row[ii];
+
+#define HALOEXCHANGE_RUN_SETUP \
+  Real_ptr var_run = var + run_starts[r]; \
+  Real_ptr buffer_run = buffer + run_offsets[r]; \
+  const Index_type run_len = run_offsets[r+1] - run_offsets[r];
+
+#define HALOEXCHANGE_RUN_PACK_BODY \
+  buffer_run[ii] = var_run[ii];
+
+#define HALOEXCHANGE_RUN_UNPACK_BODY \
+  var_run[ii] = buffer_run[ii];
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+//
+// Halo region described as a box of the grid, the i stride is one.
+//
+struct HaloBox
+{
+  Index_type offset;
+  Index_type len_i;
+  Index_type len_j;
+  Index_type len_k;
+  Index_type stride_j;
+  Index_type stride_k;
+
+  Index_type rows() const { return len_j * len_k; }
+};
+
+//
+// Number of runs of consecutive indices in the pack (or unpack) index
+// lists of the 26 neighbors of one variable. Each row of a halo box is one
+// run because the rows of the grid plus halo are longer than the rows of
+// the boxes, the rows of the 27 boxes around and including the interior
+// sum to 3 * (grid_dims[1] + 2*halo_width) * (grid_dims[2] + 2*halo_width).
+//
+inline Index_type get_num_halo_runs(const Index_type halo_width,
+                                    const Index_type* grid_dims)
+{
+  return 3 * (grid_dims[1] + 2*halo_width) * (grid_dims[2] + 2*halo_width) -
+         grid_dims[1] * grid_dims[2];
+}
+
+//
+// Bytes moved per rep by the "box" tunings, num_values is the number of
+// halo values packed (and unpacked) per rep over all variables.
+//
+inline Index_type get_box_bytes_per_rep(const Index_type num_values)
+{
+  return (1*sizeof(Real_type) + 1*sizeof(Real_type)) * num_values +
+         (1*sizeof(Real_type) + 1*sizeof(Real_type)) * num_values;
+}
+
+//
+// Bytes moved per rep by the "rle" tunings, num_runs is the number of runs
+// in the pack (or unpack) index lists over all neighbors and variables.
+//
+inline Index_type get_rle_bytes_per_rep(const Index_type num_values,
+                                        const Index_type num_runs)
+{
+  return get_box_bytes_per_rep(num_values) +
+         (0*sizeof(Int_type) + 2*sizeof(Int_type)) * num_runs +
+         (0*sizeof(Int_type) + 2*sizeof(Int_type)) * num_runs;
+}
+
+//
+// Function to compress index lists into runs of consecutive indices.
+//
+inline void create_runs(const std::vector<Int_ptr>& index_lists,
+                        const std::vector<Index_type>& index_list_lengths,
+                        std::vector<Int_ptr>& run_starts,
+                        std::vector<Int_ptr>& run_offsets,
+                        std::vector<Index_type>& num_runs,
+                        VariantID vid)
+{
+  const size_t num_lists = index_lists.size();
+
+  run_starts.resize(num_lists, nullptr);
+  run_offsets.resize(num_lists, nullptr);
+  num_runs.resize(num_lists, 0);
+
+  for (size_t l = 0; l < num_lists; ++l) {
+
+    Int_ptr list = index_lists[l];
+    Index_type len = index_list_lengths[l];
+
+    Index_type nruns = 0;
+    for (Index_type i = 0; i < len; ++i) {
+      if (i == 0 || list[i] != list[i-1] + 1) {
+        nruns += 1;
+      }
+    }
+
+    allocAndInitData(run_starts[l], nruns, vid);
+    allocAndInitData(run_offsets[l], nruns+1, vid);
+
+    Int_ptr starts = run_starts[l];
+    Int_ptr offsets = run_offsets[l];
+
+    Index_type r = 0;
+    for (Index_type i = 0; i < len; ++i) {
+      if (i == 0 || list[i] != list[i-1] + 1) {
+        starts[r] = list[i];
+        offsets[r] = i;
+        r += 1;
+      }
+    }
+    offsets[nruns] = len;
+
+    num_runs[l] = nruns;
+  }
+}
+
+//
+// Function to destroy run-length encoded index lists.
+//
+inline void destroy_runs(std::vector<Int_ptr>& run_starts,
+                         std::vector<Int_ptr>& run_offsets,
+                         std::vector<Index_type>& num_runs,
+                         VariantID vid)
+{
+  (void) vid;
+
+  for (size_t l = 0; l < run_starts.size(); ++l) {
+    deallocData(run_starts[l]);
+    deallocData(run_offsets[l]);
+  }
+  run_starts.clear();
+  run_offsets.clear();
+  num_runs.clear();
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
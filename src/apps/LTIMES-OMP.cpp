@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <type_traits>
 
 namespace rajaperf
 {
@@ -18,10 +19,26 @@ namespace apps
 {
 
 
-void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        if (tune_idx == t) {
+          runOpenMPVariantLayout<order>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   LTIMES_DATA_SETUP;
@@ -122,8 +139,139 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < size_t order >
+void LTIMES::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  //
+  // The d loop carries the sum into phi, so when it is outermost the
+  // second loop is run in parallel instead.
+  //
+  constexpr bool par_outer = ltimes_layout::loop(order, 0) != ltimes_layout::dim_d;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      LTIMES_LAYOUT_STRIDES(order);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( par_outer ) {
+
+          #pragma omp parallel for
+          for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+            for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+              for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+                for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                  LTIMES_LAYOUT_INDICES(order);
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+            #pragma omp parallel for
+            for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+              for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+                for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                  LTIMES_LAYOUT_INDICES(order);
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      LTIMES_LAYOUT_VIEWS_RANGES_RAJA(order);
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA;
+                        };
+
+      using OUTER_POL = typename std::conditional<par_outer,
+                                                  RAJA::omp_parallel_for_exec,
+                                                  RAJA::loop_exec>::type;
+      using INNER_POL = typename std::conditional<par_outer,
+                                                  RAJA::loop_exec,
+                                                  RAJA::omp_parallel_for_exec>::type;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<ltimes_layout::loop(order, 0), OUTER_POL,
+            RAJA::statement::For<ltimes_layout::loop(order, 1), INNER_POL,
+              RAJA::statement::For<ltimes_layout::loop(order, 2), RAJA::loop_exec,
+                RAJA::statement::For<ltimes_layout::loop(order, 3), RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LTIMES::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasLayoutTunings(vid) ) {
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        addVariantTuningName(vid, ltimes_layout::getTuningName(order));
+      }
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -18,8 +18,24 @@ namespace apps
 {
 
 
-void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        if (tune_idx == t) {
+          runSeqVariantLayout<order>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   LTIMES_DATA_SETUP;
@@ -121,5 +137,100 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < size_t order >
+void LTIMES::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      LTIMES_LAYOUT_STRIDES(order);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+          for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+            for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+              for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                LTIMES_LAYOUT_INDICES(order);
+                LTIMES_LAYOUT_BODY;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      LTIMES_LAYOUT_VIEWS_RANGES_RAJA(order);
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA;
+                        };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<ltimes_layout::loop(order, 0), RAJA::loop_exec,
+            RAJA::statement::For<ltimes_layout::loop(order, 1), RAJA::loop_exec,
+              RAJA::statement::For<ltimes_layout::loop(order, 2), RAJA::loop_exec,
+                RAJA::statement::For<ltimes_layout::loop(order, 3), RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LTIMES::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasLayoutTunings(vid) ) {
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        addVariantTuningName(vid, ltimes_layout::getTuningName(order));
+      }
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
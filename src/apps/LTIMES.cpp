@@ -83,15 +83,56 @@ LTIMES::~LTIMES()
 {
 }
 
-void LTIMES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool LTIMES::hasLayoutTunings(VariantID vid) const
+{
+  return vid == Base_Seq || vid == RAJA_Seq ||
+         vid == Base_OpenMP || vid == RAJA_OpenMP;
+}
+
+size_t LTIMES::getLayoutOrder(VariantID vid, size_t tune_idx) const
+{
+  size_t layout_order = ltimes_layout::default_order;
+
+  if ( hasLayoutTunings(vid) ) {
+
+    size_t t = 1;
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        if (tune_idx == t) {
+          layout_order = order;
+        }
+        t += 1;
+      }
+    });
+
+  }
+
+  return layout_order;
+}
+
+void LTIMES::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  const size_t order = getLayoutOrder(vid, tune_idx);
+  if ( order != ltimes_layout::default_order ) {
+    const Index_type len[4] = {m_num_d, m_num_z, m_num_g, m_num_m};
+    ltimes_layout::permuteData(order, m_elldat, ltimes_layout::ell_dims, len, true);
+    ltimes_layout::permuteData(order, m_psidat, ltimes_layout::psi_dims, len, true);
+  }
 }
 
 void LTIMES::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  const size_t order = getLayoutOrder(vid, tune_idx);
+  if ( order != ltimes_layout::default_order ) {
+    const Index_type len[4] = {m_num_d, m_num_z, m_num_g, m_num_m};
+    ltimes_layout::permuteData(order, m_phidat, ltimes_layout::phi_dims, len, false);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor );
 }
 
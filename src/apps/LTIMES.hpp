@@ -26,6 +26,10 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// The Base and RAJA host variants also have a tuning for each loop nest
+/// order, which use psi, phi, and ell layouts that match the order
+/// (see LTIMES_LAYOUT.hpp).
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -76,8 +80,40 @@
       using IGRange = RAJA::TypedRangeSegment<IG>; \
       using IMRange = RAJA::TypedRangeSegment<IM>;
 
+#define LTIMES_LAYOUT_VIEWS_RANGES_RAJA(order) \
+  using namespace ltimes_idx; \
+\
+  using PSI_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<3, Index_type, \
+                                     ltimes_layout::psi_perm(order, 2)>, \
+                                   IZ, IG, ID>; \
+  using ELL_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<2, Index_type, \
+                                     ltimes_layout::ell_perm(order, 1)>, \
+                                   IM, ID>; \
+  using PHI_VIEW = RAJA::TypedView<Real_type, \
+                                   RAJA::Layout<3, Index_type, \
+                                     ltimes_layout::phi_perm(order, 2)>, \
+                                   IZ, IG, IM>; \
+\
+  PSI_VIEW psi(psidat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
+                     ltimes_layout::psi_perm_array(order) ) ); \
+  ELL_VIEW ell(elldat, \
+               RAJA::make_permuted_layout( {{num_m, num_d}}, \
+                     ltimes_layout::ell_perm_array(order) ) ); \
+  PHI_VIEW phi(phidat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
+                     ltimes_layout::phi_perm_array(order) ) ); \
+\
+      using IDRange = RAJA::TypedRangeSegment<ID>; \
+      using IZRange = RAJA::TypedRangeSegment<IZ>; \
+      using IGRange = RAJA::TypedRangeSegment<IG>; \
+      using IMRange = RAJA::TypedRangeSegment<IM>;
+
 
 #include "common/KernelBase.hpp"
+#include "LTIMES_LAYOUT.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -117,8 +153,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t order >
+  void runSeqVariantLayout(VariantID vid);
+  template < size_t order >
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -128,6 +170,10 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using layout_orders_type = ltimes_layout::orders_type;
+
+  bool hasLayoutTunings(VariantID vid) const;
+  size_t getLayoutOrder(VariantID vid, size_t tune_idx) const;
 
   Real_ptr m_phidat;
   Real_ptr m_elldat;
@@ -0,0 +1,252 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Loop nest orders and matching data layouts used by the layout tunings
+/// of the LTIMES and LTIMES_NOVIEW kernels.
+///
+/// A loop nest order is encoded as a four digit integer that lists the
+/// loop indices from outermost to innermost using the ids d = 0, z = 1,
+/// g = 2, m = 3 (the order of the segments in the RAJA variant tuples).
+/// For example, 1230 is the z, g, m, d order used by the default tuning
+/// and 123 (i.e., 0123) is the d, z, g, m order.
+///
+/// The layouts of psi(z, g, d), phi(z, g, m), and ell(m, d) match the loop
+/// order: the array index nested deepest in the loop order is stride-one,
+/// the next deepest has the next smallest stride, and so on. So the default
+/// tuning uses the (z, g, d), (z, g, m), (m, d) layouts and, for example,
+/// the d, z, g, m order uses the (d, z, g), (z, g, m), (d, m) layouts.
+///
+/// Data is always initialized and checksummed in the default layouts and
+/// permuted to and from the tuning layouts in setUp and updateChecksum so
+/// all tunings produce the same checksum.
+///
+
+#ifndef RAJAPerf_Apps_LTIMES_LAYOUT_HPP
+#define RAJAPerf_Apps_LTIMES_LAYOUT_HPP
+
+#define LTIMES_LAYOUT_STRIDES(order) \
+  const Index_type len[4] = {num_d, num_z, num_g, num_m}; \
+\
+  const Index_type len0 = len[ltimes_layout::loop(order, 0)]; \
+  const Index_type len1 = len[ltimes_layout::loop(order, 1)]; \
+  const Index_type len2 = len[ltimes_layout::loop(order, 2)]; \
+  const Index_type len3 = len[ltimes_layout::loop(order, 3)]; \
+\
+  const Index_type psi_sz = ltimes_layout::stride(order, ltimes_layout::dim_z, \
+                                                  ltimes_layout::psi_dims, len); \
+  const Index_type psi_sg = ltimes_layout::stride(order, ltimes_layout::dim_g, \
+                                                  ltimes_layout::psi_dims, len); \
+  const Index_type psi_sd = ltimes_layout::stride(order, ltimes_layout::dim_d, \
+                                                  ltimes_layout::psi_dims, len); \
+  const Index_type phi_sz = ltimes_layout::stride(order, ltimes_layout::dim_z, \
+                                                  ltimes_layout::phi_dims, len); \
+  const Index_type phi_sg = ltimes_layout::stride(order, ltimes_layout::dim_g, \
+                                                  ltimes_layout::phi_dims, len); \
+  const Index_type phi_sm = ltimes_layout::stride(order, ltimes_layout::dim_m, \
+                                                  ltimes_layout::phi_dims, len); \
+  const Index_type ell_sm = ltimes_layout::stride(order, ltimes_layout::dim_m, \
+                                                  ltimes_layout::ell_dims, len); \
+  const Index_type ell_sd = ltimes_layout::stride(order, ltimes_layout::dim_d, \
+                                                  ltimes_layout::ell_dims, len);
+
+#define LTIMES_LAYOUT_INDICES(order) \
+  const Index_type iv[4] = {i0, i1, i2, i3}; \
+  const Index_type d = iv[ltimes_layout::level(order, ltimes_layout::dim_d)]; \
+  const Index_type z = iv[ltimes_layout::level(order, ltimes_layout::dim_z)]; \
+  const Index_type g = iv[ltimes_layout::level(order, ltimes_layout::dim_g)]; \
+  const Index_type m = iv[ltimes_layout::level(order, ltimes_layout::dim_m)];
+
+#define LTIMES_LAYOUT_BODY \
+  phidat[z * phi_sz + g * phi_sg + m * phi_sm] += \
+    elldat[m * ell_sm + d * ell_sd] * \
+    psidat[z * psi_sz + g * psi_sg + d * psi_sd];
+
+
+#include "common/KernelBase.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace ltimes_layout
+{
+
+//
+// Loop index ids, these match the order of the RAJA variant segment tuples.
+//
+constexpr camp::idx_t dim_d = 0;
+constexpr camp::idx_t dim_z = 1;
+constexpr camp::idx_t dim_g = 2;
+constexpr camp::idx_t dim_m = 3;
+
+//
+// Loop indices of each array in the order of the array subscripts.
+//
+constexpr camp::idx_t psi_dims[3] = {dim_z, dim_g, dim_d};
+constexpr camp::idx_t phi_dims[3] = {dim_z, dim_g, dim_m};
+constexpr camp::idx_t ell_dims[2] = {dim_m, dim_d};
+
+//
+// Order used by the default tuning (z, g, m, d).
+//
+constexpr size_t default_order = 1230;
+
+//
+// All 24 loop nest orders.
+//
+using orders_type = camp::int_seq<size_t,
+    1230, 1203, 1320, 1302, 1023, 1032,
+    2130, 2103, 2310, 2301, 2013, 2031,
+    3120, 3102, 3210, 3201, 3012, 3021,
+     123,  132,  213,  231,  312,  321>;
+
+// loop index id at nest level lev of order (level 0 is outermost)
+constexpr camp::idx_t loop(size_t order, camp::idx_t lev)
+{
+  return static_cast<camp::idx_t>( (lev == 0) ? (order / 1000) % 10
+                                 : (lev == 1) ? (order / 100) % 10
+                                 : (lev == 2) ? (order / 10) % 10
+                                 :              order % 10 );
+}
+
+// nest level of loop index id dim in order
+constexpr camp::idx_t level(size_t order, camp::idx_t dim)
+{
+  return (loop(order, 0) == dim) ? 0
+       : (loop(order, 1) == dim) ? 1
+       : (loop(order, 2) == dim) ? 2
+       :                           3;
+}
+
+// number of the three array indices a0, a1, a2 nested outside of dim
+constexpr camp::idx_t rank3(size_t order, camp::idx_t dim,
+                            camp::idx_t a0, camp::idx_t a1, camp::idx_t a2)
+{
+  return static_cast<camp::idx_t>(level(order, a0) < level(order, dim)) +
+         static_cast<camp::idx_t>(level(order, a1) < level(order, dim)) +
+         static_cast<camp::idx_t>(level(order, a2) < level(order, dim));
+}
+
+// subscript position of the k-th slowest index of a three index array
+constexpr camp::idx_t perm3(size_t order, camp::idx_t k,
+                            camp::idx_t a0, camp::idx_t a1, camp::idx_t a2)
+{
+  return (rank3(order, a0, a0, a1, a2) == k) ? 0
+       : (rank3(order, a1, a0, a1, a2) == k) ? 1
+       :                                       2;
+}
+
+// subscript position of the k-th slowest index of a two index array
+constexpr camp::idx_t perm2(size_t order, camp::idx_t k,
+                            camp::idx_t a0, camp::idx_t a1)
+{
+  return ((level(order, a0) < level(order, a1)) == (k == 0)) ? 0 : 1;
+}
+
+//
+// RAJA layout permutations (slowest to fastest) for each array,
+// the last entry is the stride-one subscript.
+//
+constexpr camp::idx_t psi_perm(size_t order, camp::idx_t k)
+{
+  return perm3(order, k, dim_z, dim_g, dim_d);
+}
+///
+constexpr camp::idx_t phi_perm(size_t order, camp::idx_t k)
+{
+  return perm3(order, k, dim_z, dim_g, dim_m);
+}
+///
+constexpr camp::idx_t ell_perm(size_t order, camp::idx_t k)
+{
+  return perm2(order, k, dim_m, dim_d);
+}
+
+inline std::array<camp::idx_t, 3> psi_perm_array(size_t order)
+{
+  return {{psi_perm(order, 0), psi_perm(order, 1), psi_perm(order, 2)}};
+}
+///
+inline std::array<camp::idx_t, 3> phi_perm_array(size_t order)
+{
+  return {{phi_perm(order, 0), phi_perm(order, 1), phi_perm(order, 2)}};
+}
+///
+inline std::array<camp::idx_t, 2> ell_perm_array(size_t order)
+{
+  return {{ell_perm(order, 0), ell_perm(order, 1)}};
+}
+
+// stride of loop index dim in an array with subscripts dims whose layout
+// matches order, len holds the extent of each loop index
+template < size_t N >
+inline Index_type stride(size_t order, camp::idx_t dim,
+                         const camp::idx_t (&dims)[N], const Index_type* len)
+{
+  Index_type s = 1;
+  for (size_t j = 0; j < N; ++j) {
+    if (level(order, dims[j]) > level(order, dim)) {
+      s *= len[dims[j]];
+    }
+  }
+  return s;
+}
+
+// copy data between the default layout and the layout matching order
+template < size_t N >
+inline void permuteData(size_t order, Real_ptr data,
+                        const camp::idx_t (&dims)[N], const Index_type* len,
+                        bool to_order)
+{
+  Index_type size = 1;
+  for (size_t j = 0; j < N; ++j) {
+    size *= len[dims[j]];
+  }
+
+  std::vector<Real_type> tmp(data, data + size);
+
+  for (Index_type i = 0; i < size; ++i) {
+    // decompose default (row-major) offset into subscripts
+    Index_type rem = i;
+    Index_type p = 0;
+    for (size_t j = N; j > 0; --j) {
+      const Index_type n = len[dims[j-1]];
+      p += (rem % n) * stride(order, dims[j-1], dims, len);
+      rem /= n;
+    }
+    if (to_order) {
+      data[p] = tmp[i];
+    } else {
+      data[i] = tmp[p];
+    }
+  }
+}
+
+// tuning name listing the loop order, ex. "layout_zgmd"
+inline std::string getTuningName(size_t order)
+{
+  const char names[] = "dzgm";
+  std::string name("layout_");
+  for (camp::idx_t lev = 0; lev < 4; ++lev) {
+    name += names[loop(order, lev)];
+  }
+  return name;
+}
+
+} // end namespace ltimes_layout
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
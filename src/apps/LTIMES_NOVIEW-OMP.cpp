@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <type_traits>
 
 namespace rajaperf
 {
@@ -18,10 +19,26 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        if (tune_idx == t) {
+          runOpenMPVariantLayout<order>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   LTIMES_NOVIEW_DATA_SETUP;
@@ -116,8 +133,138 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < size_t order >
+void LTIMES_NOVIEW::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_NOVIEW_DATA_SETUP;
+
+  LTIMES_LAYOUT_STRIDES(order);
+
+  //
+  // The d loop carries the sum into phi, so when it is outermost the
+  // second loop is run in parallel instead.
+  //
+  constexpr bool par_outer = ltimes_layout::loop(order, 0) != ltimes_layout::dim_d;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( par_outer ) {
+
+          #pragma omp parallel for
+          for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+            for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+              for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+                for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                  LTIMES_LAYOUT_INDICES(order);
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+            #pragma omp parallel for
+            for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+              for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+                for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                  LTIMES_LAYOUT_INDICES(order);
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto ltimesnoview_lam = [=](Index_type d, Index_type z,
+                                  Index_type g, Index_type m) {
+                                    LTIMES_LAYOUT_BODY;
+                              };
+
+      using OUTER_POL = typename std::conditional<par_outer,
+                                                  RAJA::omp_parallel_for_exec,
+                                                  RAJA::loop_exec>::type;
+      using INNER_POL = typename std::conditional<par_outer,
+                                                  RAJA::loop_exec,
+                                                  RAJA::omp_parallel_for_exec>::type;
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<ltimes_layout::loop(order, 0), OUTER_POL,
+            RAJA::statement::For<ltimes_layout::loop(order, 1), INNER_POL,
+              RAJA::statement::For<ltimes_layout::loop(order, 2), RAJA::loop_exec,
+                RAJA::statement::For<ltimes_layout::loop(order, 3), RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, num_d),
+                                                 RAJA::RangeSegment(0, num_z),
+                                                 RAJA::RangeSegment(0, num_g),
+                                                 RAJA::RangeSegment(0, num_m)),
+                                ltimesnoview_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n LTIMES_NOVIEW : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LTIMES_NOVIEW::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasLayoutTunings(vid) ) {
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        addVariantTuningName(vid, ltimes_layout::getTuningName(order));
+      }
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
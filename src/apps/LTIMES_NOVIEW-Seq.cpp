@@ -18,8 +18,24 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        if (tune_idx == t) {
+          runSeqVariantLayout<order>(vid);
+        }
+        t += 1;
+      }
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
 
   LTIMES_NOVIEW_DATA_SETUP;
@@ -114,5 +130,99 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < size_t order >
+void LTIMES_NOVIEW::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_NOVIEW_DATA_SETUP;
+
+  LTIMES_LAYOUT_STRIDES(order);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i0 = 0; i0 < len0; ++i0 ) {
+          for (Index_type i1 = 0; i1 < len1; ++i1 ) {
+            for (Index_type i2 = 0; i2 < len2; ++i2 ) {
+              for (Index_type i3 = 0; i3 < len3; ++i3 ) {
+                LTIMES_LAYOUT_INDICES(order);
+                LTIMES_LAYOUT_BODY;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto ltimesnoview_lam = [=](Index_type d, Index_type z,
+                                  Index_type g, Index_type m) {
+                                    LTIMES_LAYOUT_BODY;
+                              };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<ltimes_layout::loop(order, 0), RAJA::loop_exec,
+            RAJA::statement::For<ltimes_layout::loop(order, 1), RAJA::loop_exec,
+              RAJA::statement::For<ltimes_layout::loop(order, 2), RAJA::loop_exec,
+                RAJA::statement::For<ltimes_layout::loop(order, 3), RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, num_d),
+                                                 RAJA::RangeSegment(0, num_z),
+                                                 RAJA::RangeSegment(0, num_g),
+                                                 RAJA::RangeSegment(0, num_m)),
+                                ltimesnoview_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n LTIMES_NOVIEW : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LTIMES_NOVIEW::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasLayoutTunings(vid) ) {
+
+    seq_for(layout_orders_type{}, [&](auto order) {
+      if (order != ltimes_layout::default_order) {
+        addVariantTuningName(vid, ltimes_layout::getTuningName(order));
+      }
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
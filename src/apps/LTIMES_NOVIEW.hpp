@@ -22,6 +22,10 @@
 ///   }
 /// }
 ///
+/// The Base and RAJA host variants also have a tuning for each loop nest
+/// order, which use psi, phi, and ell layouts that match the order
+/// (see LTIMES_LAYOUT.hpp).
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_NOVIEW_HPP
 #define RAJAPerf_Apps_LTIMES_NOVIEW_HPP
@@ -41,6 +45,7 @@
     elldat[d+ (m * num_d)] * psidat[d+ (g * num_d) + (z * num_d * num_g)];
 
 #include "common/KernelBase.hpp"
+#include "LTIMES_LAYOUT.hpp"
 
 namespace rajaperf
 {
@@ -67,8 +72,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t order >
+  void runSeqVariantLayout(VariantID vid);
+  template < size_t order >
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -78,6 +89,10 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using layout_orders_type = ltimes_layout::orders_type;
+
+  bool hasLayoutTunings(VariantID vid) const;
+  size_t getLayoutOrder(VariantID vid, size_t tune_idx) const;
 
   Real_ptr m_phidat;
   Real_ptr m_elldat;
@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void MASS3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -38,53 +39,53 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         MASS3DPA_0_CPU
 
-         CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D){
+         CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D){
             MASS3DPA_1
           }
-          CPU_FOREACH(dx, x, MPA_Q1D) {
+          CPU_FOREACH(dx, x, Q1D) {
             MASS3DPA_2
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_3
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_4
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_5
           }
         }
 
-        CPU_FOREACH(d, y, MPA_D1D) {
-          CPU_FOREACH(q, x, MPA_Q1D) {
+        CPU_FOREACH(d, y, D1D) {
+          CPU_FOREACH(q, x, Q1D) {
             MASS3DPA_6
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_7
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_8
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_9
           }
         }
@@ -120,15 +121,15 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               MASS3DPA_0_CPU
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_1
                     }
                   );  // RAJA::expt::loop<inner_x>
 
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int dx) {
                       MASS3DPA_2
                     }
@@ -138,9 +139,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_3
                     }
@@ -150,9 +151,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_4
                     }
@@ -162,9 +163,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_5
                     }
@@ -174,9 +175,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int d) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int q) {
                       MASS3DPA_6
                     }
@@ -186,9 +187,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_7
                     }
@@ -198,9 +199,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_8
                     }
@@ -210,9 +211,9 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_9
                     }
@@ -242,5 +243,83 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+template < int D1D, int Q1D >
+void MASS3DPA::runOpenMPVariantSimdImpl(VariantID vid) {
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MASS3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#pragma omp parallel for
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        MASS3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  case RAJA_OpenMP: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        MASS3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+  default:
+    getCout() << "\n MASS3DPA : Unknown OpenMP variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MASS3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runOpenMPVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runOpenMPVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void MASS3DPA::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
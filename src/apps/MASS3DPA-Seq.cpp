@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < int D1D, int Q1D >
+void MASS3DPA::runSeqVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   MASS3DPA_DATA_SETUP;
@@ -35,53 +36,53 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
         MASS3DPA_0_CPU
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D){
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D){
             MASS3DPA_1
           }
-          CPU_FOREACH(dx, x, MPA_Q1D) {
+          CPU_FOREACH(dx, x, Q1D) {
             MASS3DPA_2
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_3
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_4
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
             MASS3DPA_5
           }
         }
 
-        CPU_FOREACH(d, y, MPA_D1D) {
-          CPU_FOREACH(q, x, MPA_Q1D) {
+        CPU_FOREACH(d, y, D1D) {
+          CPU_FOREACH(q, x, Q1D) {
             MASS3DPA_6
           }
         }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_7
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_8
           }
         }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
             MASS3DPA_9
           }
         }
@@ -117,15 +118,15 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               MASS3DPA_0_CPU
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_1
                     }
                   );  // RAJA::expt::loop<inner_x>
 
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int dx) {
                       MASS3DPA_2
                     }
@@ -135,9 +136,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_3
                     }
@@ -147,9 +148,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_4
                     }
@@ -159,9 +160,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int qx) {
                       MASS3DPA_5
                     }
@@ -171,9 +172,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int d) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
                     [&](int q) {
                       MASS3DPA_6
                     }
@@ -183,9 +184,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_Q1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
                 [&](int qy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_7
                     }
@@ -195,9 +196,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_8
                     }
@@ -207,9 +208,9 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
               ctx.teamSync();
 
-              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+              RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
                 [&](int dy) {
-                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, MPA_D1D),
+                  RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
                     [&](int dx) {
                       MASS3DPA_9
                     }
@@ -235,5 +236,76 @@ void MASS3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   }
 }
 
+template < int D1D, int Q1D >
+void MASS3DPA::runSeqVariantSimdImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  MASS3DPA_DATA_SETUP;
+
+  const Index_type nbatches = (NE + RAJAPERF_PA_SIMD_WIDTH - 1) /
+                              RAJAPERF_PA_SIMD_WIDTH;
+
+  switch (vid) {
+
+  case Base_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type eb = 0; eb < nbatches; ++eb) {
+        MASS3DPA_SIMD_BODY
+      } // element batch loop
+
+    }
+    stopTimer();
+
+    break;
+  }
+
+#if defined(RUN_RAJA_SEQ)
+  case RAJA_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::loop_exec>(
+        RAJA::RangeSegment(0, nbatches), [=](Index_type eb) {
+        MASS3DPA_SIMD_BODY
+      });
+
+    }
+    stopTimer();
+
+    break;
+  }
+#endif // RUN_RAJA_SEQ
+
+  default:
+    getCout() << "\n MASS3DPA : Unknown Seq variant id = " << vid << std::endl;
+  }
+}
+
+void MASS3DPA::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  seq_for(pa_orders_type{}, [&](auto order) {
+    if ( order+1 == m_D1D && order+2 == m_Q1D ) {
+      if ( tune_idx == 1 ) {
+        runSeqVariantSimdImpl<order+1, order+2>(vid);
+      } else {
+        runSeqVariantImpl<order+1, order+2>(vid);
+      }
+    }
+  });
+}
+
+void MASS3DPA::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "simd_elements");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
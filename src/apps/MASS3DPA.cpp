@@ -25,28 +25,35 @@ MASS3DPA::MASS3DPA(const RunParams& params)
 {
   m_NE_default = 8000;
 
+  m_D1D = MPA_D1D;
+  m_Q1D = MPA_Q1D;
+  if ( params.getPAOrder() > 0 ) {
+    m_D1D = params.getPAOrder() + 1;
+    m_Q1D = params.getPAOrder() + 2;
+  }
+
   setDefaultProblemSize(m_NE_default*MPA_Q1D*MPA_Q1D*MPA_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(MPA_Q1D*MPA_Q1D*MPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*MPA_Q1D*MPA_Q1D*MPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D));
+  setBytesPerRep( m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_Q1D*m_Q1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) );
+
+  setFLOPsPerRep(m_NE * (2 * m_D1D * m_D1D * m_D1D * m_Q1D +
+                         2 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                         2 * m_D1D * m_Q1D * m_Q1D * m_Q1D + m_Q1D * m_Q1D * m_Q1D +
+                         2 * m_Q1D * m_Q1D * m_Q1D * m_D1D +
+                         2 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                         2 * m_Q1D * m_D1D * m_D1D * m_D1D + m_D1D * m_D1D * m_D1D));
   setUsesFeature(Teams);
 
   setVariantDefined( Base_Seq );
@@ -55,11 +62,16 @@ MASS3DPA::MASS3DPA(const RunParams& params)
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // GPU variants are only compiled for the default order
+  if ( m_D1D == MPA_D1D && m_Q1D == MPA_Q1D ) {
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
+
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+  }
 
 }
 
@@ -70,16 +82,16 @@ MASS3DPA::~MASS3DPA()
 void MASS3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
 
-  allocAndInitDataConst(m_B, int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt,int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt,int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void MASS3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, MPA_D1D*MPA_D1D*MPA_D1D*m_NE);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void MASS3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
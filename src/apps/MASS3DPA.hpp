@@ -151,6 +151,15 @@
 ///
 /// } // element loop
 ///
+/// The default order has MPA_D1D dofs and MPA_Q1D quadrature points in 1D.
+/// The host variants are templated on (D1D, Q1D) and also run the order
+/// set with --pa-order, order p has D1D = p+1 and Q1D = p+2.
+///
+/// The "simd_elements" tuning of the Base and RAJA host variants runs
+/// batches of RAJAPERF_PA_SIMD_WIDTH elements, the batch is the fastest
+/// index of the intermediate arrays so each contraction vectorizes across
+/// the elements of the batch.
+///
 
 #ifndef RAJAPerf_Apps_MASS3DPA_HPP
 #define RAJAPerf_Apps_MASS3DPA_HPP
@@ -168,21 +177,22 @@ Index_type NE = m_NE;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
+//Number of Dofs/Qpts in 1D of the default order, GPU variants only run
+//this order, host variants run any order in RAJAPERF_PA_ORDERS
 #define MPA_D1D 4
 #define MPA_Q1D 5
-#define B_(x, y) B[x + MPA_Q1D * y]
-#define Bt_(x, y) Bt[x + MPA_D1D * y]
+#define B_(x, y) B[x + MQ1 * y]
+#define Bt_(x, y) Bt[x + MD1 * y]
 #define X_(dx, dy, dz, e)                                                      \
-  X[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define Y_(dx, dy, dz, e)                                                      \
-  Y[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define D_(qx, qy, qz, e)                                                      \
-  D[qx + MPA_Q1D * qy + MPA_Q1D * MPA_Q1D * qz + MPA_Q1D * MPA_Q1D * MPA_Q1D * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * e]
 
 #define MASS3DPA_0_CPU           \
-        constexpr int MQ1 = MPA_Q1D; \
-        constexpr int MD1 = MPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sDQ[MQ1 * MD1]; \
         double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
@@ -214,130 +224,302 @@ Index_type NE = m_NE;
 
 #define MASS3DPA_1 \
   RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz< MPA_D1D; ++dz) { \
+for (int dz = 0; dz< MD1; ++dz) { \
 Xsmem[dz][dy][dx] = X_(dx, dy, dz, e); \
 }
 
 #define MASS3DPA_2 \
   Bsmem[dx][dy] = B_(dx, dy);
 
-// 2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D
+// 2 * MD1 * MD1 * MD1 * MQ1
 #define MASS3DPA_3 \
-  double u[MPA_D1D]; \
+  double u[MD1]; \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; dz++) { \
+for (int dz = 0; dz < MD1; dz++) { \
 u[dz] = 0; \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dx = 0; dx < MPA_D1D; ++dx) { \
+for (int dx = 0; dx < MD1; ++dx) { \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 u[dz] += Xsmem[dz][dy][dx] * Bsmem[qx][dx]; \
 } \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 DDQ[dz][dy][qx] = u[dz]; \
 }
 
-//2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MD1 * MQ1 * MQ1
 #define MASS3DPA_4 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dy = 0; dy < MPA_D1D; ++dy) { \
+            for (int dy = 0; dy < MD1; ++dy) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; dz++) { \
+              for (int dz = 0; dz < MD1; dz++) { \
                 u[dz] += DDQ[dz][dy][qx] * Bsmem[qy][dy]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               DQQ[dz][qy][qx] = u[dz]; \
             }
 
-//2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MQ1 * MQ1 * MQ1 + MQ1 * MQ1 * MQ1
 #define MASS3DPA_5 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; qz++) { \
+              for (int qz = 0; qz < MQ1; qz++) { \
                 u[qz] += DQQ[dz][qy][qx] * Bsmem[qz][dz]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               QQQ[qz][qy][qx] = u[qz] * D_(qx, qy, qz, e); \
             }
 
 #define MASS3DPA_6 \
   Btsmem[d][q] = Bt_(q, d);
 
-//2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D
+//2 * MQ1 * MQ1 * MQ1 * MD1
 #define MASS3DPA_7 \
-  double u[MPA_Q1D]; \
+  double u[MQ1]; \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   u[qz] = 0; \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qx = 0; qx < MPA_Q1D; ++qx) { \
+for (int qx = 0; qx < MQ1; ++qx) { \
   RAJAPERF_UNROLL(MQ1) \
-    for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+    for (int qz = 0; qz < MQ1; ++qz) { \
       u[qz] += QQQ[qz][qy][qx] * Btsmem[dx][qx]; \
     } \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   QQD[qz][qy][dx] = u[qz]; \
  }
 
-// 2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D
+// 2 * MQ1 * MQ1 * MD1 * MD1
 #define MASS3DPA_8 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qy = 0; qy < MPA_Q1D; ++qy) { \
+            for (int qy = 0; qy < MQ1; ++qy) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
                 u[qz] += QQD[qz][qy][dx] * Btsmem[dy][qy]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               QDD[qz][dy][dx] = u[qz]; \
             }
 
-//2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D
+//2 * MQ1 * MD1 * MD1 * MD1 + MD1 * MD1 * MD1
 #define MASS3DPA_9 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; ++dz) { \
+              for (int dz = 0; dz < MD1; ++dz) { \
                 u[dz] += QDD[qz][dy][dx] * Btsmem[dz][qz]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               Y_(dx, dy, dz, e) += u[dz]; \
             }
 
+//
+// simd_elements tuning, each contraction is done for a batch of NB elements
+// at a time with the element in the batch as the fastest index of the
+// intermediate arrays
+//
+#define MASS3DPA_SIMD_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        constexpr int NB = RAJAPERF_PA_SIMD_WIDTH; \
+        const Index_type e0 = eb * NB; \
+        const int nb = (NE - e0 < NB) ? NE - e0 : NB; \
+        double sDQ[MQ1 * MD1]; \
+        double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
+        double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ; \
+        double sm0[MDQ * MDQ * MDQ * NB]; \
+        double sm1[MDQ * MDQ * MDQ * NB]; \
+        double(*Xsmem)[MD1][MD1][NB] = (double(*)[MD1][MD1][NB])sm0; \
+        double(*DDQ)[MD1][MQ1][NB] = (double(*)[MD1][MQ1][NB])sm1; \
+        double(*DQQ)[MQ1][MQ1][NB] = (double(*)[MQ1][MQ1][NB])sm0; \
+        double(*QQQ)[MQ1][MQ1][NB] = (double(*)[MQ1][MQ1][NB])sm1; \
+        double(*QQD)[MQ1][MD1][NB] = (double(*)[MQ1][MD1][NB])sm0; \
+        double(*QDD)[MD1][MD1][NB] = (double(*)[MD1][MD1][NB])sm1;
+
+#define MASS3DPA_SIMD_1 \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { \
+      Xsmem[dz][dy][dx][ie] = X_(dx, dy, dz, BATCH_ELEM(ie)); \
+    } \
+  }
+
+#define MASS3DPA_SIMD_3 \
+  double u[MD1][NB]; \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { u[dz][ie] = 0; } \
+  } \
+  for (int dx = 0; dx < MD1; ++dx) { \
+    const double b = Bsmem[qx][dx]; \
+    for (int dz = 0; dz < MD1; ++dz) { \
+      CPU_FOREACH_BATCH(ie) { u[dz][ie] += Xsmem[dz][dy][dx][ie] * b; } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { DDQ[dz][dy][qx][ie] = u[dz][ie]; } \
+  }
+
+#define MASS3DPA_SIMD_4 \
+  double u[MD1][NB]; \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { u[dz][ie] = 0; } \
+  } \
+  for (int dy = 0; dy < MD1; ++dy) { \
+    const double b = Bsmem[qy][dy]; \
+    for (int dz = 0; dz < MD1; ++dz) { \
+      CPU_FOREACH_BATCH(ie) { u[dz][ie] += DDQ[dz][dy][qx][ie] * b; } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { DQQ[dz][qy][qx][ie] = u[dz][ie]; } \
+  }
+
+#define MASS3DPA_SIMD_5 \
+  double u[MQ1][NB]; \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { u[qz][ie] = 0; } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int qz = 0; qz < MQ1; ++qz) { \
+      const double b = Bsmem[qz][dz]; \
+      CPU_FOREACH_BATCH(ie) { u[qz][ie] += DQQ[dz][qy][qx][ie] * b; } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { \
+      QQQ[qz][qy][qx][ie] = u[qz][ie] * D_(qx, qy, qz, BATCH_ELEM(ie)); \
+    } \
+  }
+
+#define MASS3DPA_SIMD_7 \
+  double u[MQ1][NB]; \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { u[qz][ie] = 0; } \
+  } \
+  for (int qx = 0; qx < MQ1; ++qx) { \
+    const double b = Btsmem[dx][qx]; \
+    for (int qz = 0; qz < MQ1; ++qz) { \
+      CPU_FOREACH_BATCH(ie) { u[qz][ie] += QQQ[qz][qy][qx][ie] * b; } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { QQD[qz][qy][dx][ie] = u[qz][ie]; } \
+  }
+
+#define MASS3DPA_SIMD_8 \
+  double u[MQ1][NB]; \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { u[qz][ie] = 0; } \
+  } \
+  for (int qy = 0; qy < MQ1; ++qy) { \
+    const double b = Btsmem[dy][qy]; \
+    for (int qz = 0; qz < MQ1; ++qz) { \
+      CPU_FOREACH_BATCH(ie) { u[qz][ie] += QQD[qz][qy][dx][ie] * b; } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    CPU_FOREACH_BATCH(ie) { QDD[qz][dy][dx][ie] = u[qz][ie]; } \
+  }
+
+#define MASS3DPA_SIMD_9 \
+  double u[MD1][NB]; \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    CPU_FOREACH_BATCH(ie) { u[dz][ie] = 0; } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int dz = 0; dz < MD1; ++dz) { \
+      const double b = Btsmem[dz][qz]; \
+      CPU_FOREACH_BATCH(ie) { u[dz][ie] += QDD[qz][dy][dx][ie] * b; } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int ie = 0; ie < nb; ++ie) { \
+      Y_(dx, dy, dz, (e0 + ie)) += u[dz][ie]; \
+    } \
+  }
+
+// batch eb of elements, steps 2 and 6 load B and Bt as in the default tuning
+#define MASS3DPA_SIMD_BODY \
+  MASS3DPA_SIMD_0_CPU \
+  CPU_FOREACH(dy, y, MD1) { \
+    CPU_FOREACH(dx, x, MD1) { \
+      MASS3DPA_SIMD_1 \
+    } \
+    CPU_FOREACH(dx, x, MQ1) { \
+      MASS3DPA_2 \
+    } \
+  } \
+  CPU_FOREACH(dy, y, MD1) { \
+    CPU_FOREACH(qx, x, MQ1) { \
+      MASS3DPA_SIMD_3 \
+    } \
+  } \
+  CPU_FOREACH(qy, y, MQ1) { \
+    CPU_FOREACH(qx, x, MQ1) { \
+      MASS3DPA_SIMD_4 \
+    } \
+  } \
+  CPU_FOREACH(qy, y, MQ1) { \
+    CPU_FOREACH(qx, x, MQ1) { \
+      MASS3DPA_SIMD_5 \
+    } \
+  } \
+  CPU_FOREACH(d, y, MD1) { \
+    CPU_FOREACH(q, x, MQ1) { \
+      MASS3DPA_6 \
+    } \
+  } \
+  CPU_FOREACH(qy, y, MQ1) { \
+    CPU_FOREACH(dx, x, MD1) { \
+      MASS3DPA_SIMD_7 \
+    } \
+  } \
+  CPU_FOREACH(dy, y, MD1) { \
+    CPU_FOREACH(dx, x, MD1) { \
+      MASS3DPA_SIMD_8 \
+    } \
+  } \
+  CPU_FOREACH(dy, y, MD1) { \
+    CPU_FOREACH(dx, x, MD1) { \
+      MASS3DPA_SIMD_9 \
+    } \
+  }
+
 
 namespace rajaperf
 {
@@ -364,16 +546,27 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantSimdImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantSimdImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = MPA_Q1D * MPA_Q1D;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  using pa_orders_type = camp::int_seq<int, RAJAPERF_PA_ORDERS>;
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -381,6 +574,9 @@ private:
   Real_ptr m_X;
   Real_ptr m_Y;
 
+  Index_type m_D1D;
+  Index_type m_Q1D;
+
   Index_type m_NE;
   Index_type m_NE_default;
 };
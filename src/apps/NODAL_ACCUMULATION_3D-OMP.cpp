@@ -20,10 +20,23 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "color" ) {
+    runOpenMPVariantColor(vid);
+    return;
+  } else if ( tuning_name == "gather" ) {
+    runOpenMPVariantGather(vid);
+    return;
+  } else if ( tuning_name == "morton" || tuning_name == "hilbert" ) {
+    runOpenMPVariantSfc(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -138,10 +151,235 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantColor(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (size_t c = 0; c < num_colors; ++c) {
+          const Index_type* color_zones = m_color_zones[c].data();
+          const Index_type iend = m_color_zones[c].size();
+          #pragma omp parallel for
+          for (Index_type ii = 0 ; ii < iend ; ++ii ) {
+            Index_type i = color_zones[ii];
+            NODAL_ACCUMULATION_3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedIndexSet< RAJA::TypedListSegment<Index_type> > colors;
+      for (size_t c = 0; c < num_colors; ++c) {
+        colors.push_back( RAJA::TypedListSegment<Index_type>(
+                            m_color_zones[c].data(), m_color_zones[c].size(),
+                            working_res) );
+      }
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit,
+                                        RAJA::omp_parallel_for_exec>;
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(colors, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantGather(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type nn = 0 ; nn < n_nodes ; ++nn ) {
+          NODAL_ACCUMULATION_3D_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto nodal_accumulation_3d_lam = [=](Index_type nn) {
+                                         NODAL_ACCUMULATION_3D_GATHER_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, n_nodes), nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantSfc(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_sfc_zones.size();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  const Index_type* sfc_zones = m_sfc_zones.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          Index_type i = sfc_zones[ii];
+
+          Real_type val = 0.125 * vol[i];
+
+          #pragma omp atomic
+          x0[i] += val;
+          #pragma omp atomic
+          x1[i] += val;
+          #pragma omp atomic
+          x2[i] += val;
+          #pragma omp atomic
+          x3[i] += val;
+          #pragma omp atomic
+          x4[i] += val;
+          #pragma omp atomic
+          x5[i] += val;
+          #pragma omp atomic
+          x6[i] += val;
+          #pragma omp atomic
+          x7[i] += val;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedListSegment<Index_type> zones(m_sfc_zones.data(),
+                                               m_sfc_zones.size(),
+                                               working_res);
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          zones, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasAtomicFreeTunings(vid) ) {
+    addVariantTuningName(vid, "color");
+    addVariantTuningName(vid, "gather");
+    addVariantTuningName(vid, "morton");
+    addVariantTuningName(vid, "hilbert");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -20,8 +20,21 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "color" ) {
+    runSeqVariantColor(vid);
+    return;
+  } else if ( tuning_name == "gather" ) {
+    runSeqVariantGather(vid);
+    return;
+  } else if ( tuning_name == "morton" || tuning_name == "hilbert" ) {
+    runSeqVariantSfc(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
@@ -100,5 +113,197 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+void NODAL_ACCUMULATION_3D::runSeqVariantColor(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (size_t c = 0; c < num_colors; ++c) {
+          const Index_type* color_zones = m_color_zones[c].data();
+          const Index_type iend = m_color_zones[c].size();
+          for (Index_type ii = 0 ; ii < iend ; ++ii ) {
+            Index_type i = color_zones[ii];
+            NODAL_ACCUMULATION_3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedIndexSet< RAJA::TypedListSegment<Index_type> > colors;
+      for (size_t c = 0; c < num_colors; ++c) {
+        colors.push_back( RAJA::TypedListSegment<Index_type>(
+                            m_color_zones[c].data(), m_color_zones[c].size(),
+                            working_res) );
+      }
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>;
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                         NODAL_ACCUMULATION_3D_BODY;
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(colors, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantGather(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type nn = 0 ; nn < n_nodes ; ++nn ) {
+          NODAL_ACCUMULATION_3D_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto nodal_accumulation_3d_lam = [=](Index_type nn) {
+                         NODAL_ACCUMULATION_3D_GATHER_BODY;
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, n_nodes), nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantSfc(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_sfc_zones.size();
+
+  NODAL_ACCUMULATION_3D_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  const Index_type* sfc_zones = m_sfc_zones.data();
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          Index_type i = sfc_zones[ii];
+          NODAL_ACCUMULATION_3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedListSegment<Index_type> zones(m_sfc_zones.data(),
+                                               m_sfc_zones.size(),
+                                               working_res);
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                         NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(zones, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( hasAtomicFreeTunings(vid) ) {
+    addVariantTuningName(vid, "color");
+    addVariantTuningName(vid, "gather");
+    addVariantTuningName(vid, "morton");
+    addVariantTuningName(vid, "hilbert");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -74,10 +74,104 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+bool NODAL_ACCUMULATION_3D::hasAtomicFreeTunings(VariantID vid) const
+{
+  return vid == Base_Seq || vid == RAJA_Seq ||
+         vid == Base_OpenMP || vid == RAJA_OpenMP;
+}
+
+//
+// Split the real zones into 8 colors by the parity of their i, j, k
+// indices, zones of the same color do not share any nodes.
+//
+void NODAL_ACCUMULATION_3D::setUpColors()
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+
+  for (size_t c = 0; c < num_colors; ++c) {
+    m_color_zones[c].clear();
+  }
+
+  for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+    Index_type iz = m_domain->real_zones[ii];
+    Index_type i = iz % jp;
+    Index_type j = (iz / jp) % (kp / jp);
+    Index_type k = iz / kp;
+    size_t c = (i % 2) + 2 * (j % 2) + 4 * (k % 2);
+    m_color_zones[c].push_back(iz);
+  }
+}
+
+//
+// Build the nodes touched by the real zones and, for each node, the list
+// of real zones it receives contributions from. Zones are listed in the
+// order the scatter loop visits them.
+//
+void NODAL_ACCUMULATION_3D::setUpNodeZoneLists()
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type node_offsets[8] = {0, 1, jp, 1+jp, kp, 1+kp, jp+kp, 1+jp+kp};
+
+  std::vector<Index_type> num_node_zones(m_nodal_array_length, 0);
+  for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+    Index_type iz = m_domain->real_zones[ii];
+    for (Index_type in = 0; in < 8; ++in) {
+      num_node_zones[iz + node_offsets[in]] += 1;
+    }
+  }
+
+  m_nodes.clear();
+  m_node_zone_offsets.assign(1, 0);
+  std::vector<Index_type> node_pos(m_nodal_array_length, -1);
+  for (Index_type n = 0; n < m_nodal_array_length; ++n) {
+    if (num_node_zones[n] > 0) {
+      node_pos[n] = m_nodes.size();
+      m_nodes.push_back(n);
+      m_node_zone_offsets.push_back(m_node_zone_offsets.back() + num_node_zones[n]);
+    }
+  }
+
+  m_node_zones.assign(m_node_zone_offsets.back(), 0);
+  std::vector<Index_type> fill(m_node_zone_offsets.begin(), m_node_zone_offsets.end()-1);
+  for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+    Index_type iz = m_domain->real_zones[ii];
+    for (Index_type in = 0; in < 8; ++in) {
+      Index_type nn = node_pos[iz + node_offsets[in]];
+      m_node_zones[fill[nn]++] = iz;
+    }
+  }
+}
+
+//
+// Sort the real zones along the space-filling curve of the "morton" or
+// "hilbert" tuning.
+//
+void NODAL_ACCUMULATION_3D::setUpSfcZones(const std::string& tuning_name)
+{
+  setSpaceFillingCurveOrder(m_sfc_zones,
+                            m_domain->real_zones, m_domain->n_real_zones,
+                            m_domain->jp, m_domain->kp,
+                            (tuning_name == "morton") ? MeshOrdering::Morton
+                                                      : MeshOrdering::Hilbert);
+}
+
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
+
+  if ( hasAtomicFreeTunings(vid) ) {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    if ( tuning_name == "color" ) {
+      setUpColors();
+    } else if ( tuning_name == "gather" ) {
+      setUpNodeZoneLists();
+    } else if ( tuning_name == "morton" || tuning_name == "hilbert" ) {
+      setUpSfcZones(tuning_name);
+    }
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
@@ -91,6 +185,14 @@ void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
   deallocData(m_x);
   deallocData(m_vol);
+
+  for (size_t c = 0; c < num_colors; ++c) {
+    std::vector<Index_type>().swap(m_color_zones[c]);
+  }
+  std::vector<Index_type>().swap(m_nodes);
+  std::vector<Index_type>().swap(m_node_zone_offsets);
+  std::vector<Index_type>().swap(m_node_zones);
+  std::vector<Index_type>().swap(m_sfc_zones);
 }
 
 } // end namespace apps
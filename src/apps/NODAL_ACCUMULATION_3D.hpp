@@ -27,6 +27,30 @@
 ///
 /// }
 ///
+/// The Base and RAJA host variants also have two atomic-free tunings:
+///
+///  "color" runs the zones in 8 colors, (i%2) + 2*(j%2) + 4*(k%2), where
+///          zones of the same color share no nodes, so each color is run
+///          in parallel with the body above.
+///
+///  "gather" inverts the mapping and runs over the nodes of the real zones,
+///           each node sums the contributions of its zones using
+///           precomputed node-to-zone lists:
+///
+///   for (Index_type nn = 0; nn < n_nodes; ++nn ) {
+///     Index_type n = nodes[nn];
+///     Real_type val = 0.0;
+///     for (Index_type iz = node_zone_offsets[nn];
+///          iz < node_zone_offsets[nn+1]; ++iz ) {
+///       val += 0.125 * vol[node_zones[iz]];
+///     }
+///     x[n] += val;
+///   }
+///
+/// and "morton" and "hilbert" tunings that run the default body over the
+/// real zones sorted along the Morton or Hilbert space-filling curve, see
+/// setSpaceFillingCurveOrder in AppsData.hpp.
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
@@ -66,10 +90,30 @@
   RAJA::atomicAdd<policy>(&x6[i], val); \
   RAJA::atomicAdd<policy>(&x7[i], val);
 
+#define NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_type n_nodes = m_nodes.size(); \
+  Index_ptr nodes = m_nodes.data(); \
+  Index_ptr node_zone_offsets = m_node_zone_offsets.data(); \
+  Index_ptr node_zones = m_node_zones.data();
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY \
+  Index_type n = nodes[nn]; \
+  Real_type val = 0.0; \
+  for (Index_type iz = node_zone_offsets[nn]; \
+       iz < node_zone_offsets[nn+1]; ++iz ) { \
+    val += 0.125 * vol[node_zones[iz]]; \
+  } \
+  x[n] += val;
+
 
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -96,8 +140,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantColor(VariantID vid);
+  void runSeqVariantGather(VariantID vid);
+  void runOpenMPVariantColor(VariantID vid);
+  void runOpenMPVariantGather(VariantID vid);
+  void runSeqVariantSfc(VariantID vid);
+  void runOpenMPVariantSfc(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -107,12 +159,27 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  static const size_t num_colors = 8;
+
+  bool hasAtomicFreeTunings(VariantID vid) const;
+  void setUpColors();
+  void setUpNodeZoneLists();
+  void setUpSfcZones(const std::string& tuning_name);
+
   Real_ptr m_x;
   Real_ptr m_vol;
 
   ADomain* m_domain;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
+
+  std::vector<Index_type> m_color_zones[num_colors];
+
+  std::vector<Index_type> m_nodes;
+  std::vector<Index_type> m_node_zone_offsets;
+  std::vector<Index_type> m_node_zones;
+
+  std::vector<Index_type> m_sfc_zones;
 };
 
 } // end namespace apps
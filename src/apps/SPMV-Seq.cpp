@@ -0,0 +1,219 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void SPMV::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "ell" ) {
+
+    runSeqVariantEll(vid);
+    return;
+
+  } else if ( tuning_name == "sell" ) {
+
+    runSeqVariantSell(vid);
+    return;
+
+  }
+
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_CSR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < num_rows; ++i ) {
+          SPMV_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto spmv_lam = [=](Index_type i) {
+                        SPMV_BODY;
+                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < num_rows; ++i ) {
+          spmv_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_rows), [=](Index_type i) {
+          SPMV_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariantEll(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_ELL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < num_rows; ++i ) {
+          SPMV_ELL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_rows), [=](Index_type i) {
+          SPMV_ELL_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariantSell(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_SELL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < sell_num_chunks; ++c ) {
+          SPMV_SELL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, sell_num_chunks), [=](Index_type c) {
+          SPMV_SELL_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "ell");
+    setVariantTuningBytesPerRep(vid, "ell", m_ell_bytes_per_rep);
+    setVariantTuningFLOPsPerRep(vid, "ell", 2 * m_ell_num_entries);
+    addVariantTuningName(vid, "sell");
+    setVariantTuningBytesPerRep(vid, "sell", m_sell_bytes_per_rep);
+    setVariantTuningFLOPsPerRep(vid, "sell", 2 * m_sell_num_entries);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,325 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+SPMV::SPMV(const RunParams& params)
+  : KernelBase(rajaperf::Apps_SPMV, params)
+{
+  setDefaultProblemSize(100*100*100);
+  setDefaultReps(50);
+
+  m_matrix = params.getSpmvMatrix();
+
+  m_grid_size = std::max(static_cast<Index_type>(
+                           std::cbrt(getTargetProblemSize()) + 0.5),
+                         static_cast<Index_type>(1));
+
+  if ( m_matrix == RunParams::SpmvMatrix::RandomGraph ) {
+    m_num_rows = std::max(getTargetProblemSize(), static_cast<Index_type>(1));
+  } else {
+    m_num_rows = m_grid_size * m_grid_size * m_grid_size;
+  }
+
+  setActualProblemSize( m_num_rows );
+
+  {
+    std::vector<Int_type> row_ptr;
+    std::vector<Int_type> col;
+    std::vector<Real_type> val;
+    makeMatrix(row_ptr, col, val);
+    m_num_nonzeros = row_ptr[m_num_rows];
+
+    m_ell_num_entries = getEllWidth(row_ptr) * m_num_rows;
+
+    std::vector<Int_type> perm;
+    std::vector<Int_type> chunk_len;
+    makeSellChunks(row_ptr, perm, chunk_len);
+    m_sell_num_entries = 0;
+    for (Int_type len : chunk_len) {
+      m_sell_num_entries += len * sell_chunk_rows;
+    }
+  }
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // touched data size of the CSR matrix, not actual number of stores and loads
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_rows +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_num_rows+1) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+                   0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_nonzeros );
+  setFLOPsPerRep(2 * m_num_nonzeros);
+
+  // the ell and sell storage load and multiply their padding entries too
+  const Index_type num_chunks = (m_num_rows + sell_chunk_rows - 1) / sell_chunk_rows;
+  m_ell_bytes_per_rep =
+      (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_rows +
+      (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+       0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_ell_num_entries;
+  m_sell_bytes_per_rep =
+      (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_num_rows +
+      (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_num_rows + 2*num_chunks+1) +
+      (0*sizeof(Int_type) + 1*sizeof(Int_type) +
+       0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_sell_num_entries;
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  m_row_ptr = nullptr;
+  m_col = nullptr;
+  m_val = nullptr;
+  m_ell_width = 0;
+  m_ell_col = nullptr;
+  m_ell_val = nullptr;
+  m_sell_chunk_ptr = nullptr;
+  m_sell_chunk_len = nullptr;
+  m_sell_perm = nullptr;
+  m_sell_col = nullptr;
+  m_sell_val = nullptr;
+}
+
+SPMV::~SPMV()
+{
+}
+
+//
+// Make the CSR matrix, rows of the stencil matrices are grid points ordered
+// x fastest and have an entry for each neighbor in the grid.
+//
+void SPMV::makeMatrix(std::vector<Int_type>& row_ptr,
+                      std::vector<Int_type>& col,
+                      std::vector<Real_type>& val) const
+{
+  row_ptr.assign(1, 0);
+  col.clear();
+  val.clear();
+
+  if ( m_matrix == RunParams::SpmvMatrix::RandomGraph ) {
+
+    const Index_type mean_row_len = 16;
+
+    srand(4793);
+
+    std::vector<Int_type> row_col;
+    for (Index_type i = 0; i < m_num_rows; ++i) {
+      const Index_type row_len = 1 + rand() % (2*mean_row_len - 1);
+      row_col.assign(1, i);
+      for (Index_type j = 1; j < row_len; ++j) {
+        row_col.push_back(rand() % m_num_rows);
+      }
+      std::sort(row_col.begin(), row_col.end());
+      row_col.erase(std::unique(row_col.begin(), row_col.end()), row_col.end());
+      for (Int_type c : row_col) {
+        col.push_back(c);
+        val.push_back(Real_type(rand())/RAND_MAX);
+      }
+      row_ptr.push_back(col.size());
+    }
+
+  } else {
+
+    const bool is_7pt = (m_matrix == RunParams::SpmvMatrix::Stencil7pt);
+    const Real_type diag = is_7pt ? 6.0 : 26.0;
+    const Index_type n = m_grid_size;
+
+    for (Index_type k = 0; k < n; ++k) {
+      for (Index_type j = 0; j < n; ++j) {
+        for (Index_type i = 0; i < n; ++i) {
+
+          for (Index_type dk = -1; dk <= 1; ++dk) {
+            for (Index_type dj = -1; dj <= 1; ++dj) {
+              for (Index_type di = -1; di <= 1; ++di) {
+                if ( is_7pt && std::abs(di) + std::abs(dj) + std::abs(dk) > 1 ) {
+                  continue;
+                }
+                if ( i+di < 0 || i+di >= n ||
+                     j+dj < 0 || j+dj >= n ||
+                     k+dk < 0 || k+dk >= n ) {
+                  continue;
+                }
+                const bool is_diag = (di == 0 && dj == 0 && dk == 0);
+                col.push_back((i+di) + n*((j+dj) + n*(k+dk)));
+                val.push_back(is_diag ? diag : -1.0);
+              }
+            }
+          }
+          row_ptr.push_back(col.size());
+
+        }
+      }
+    }
+
+  }
+}
+
+//
+// Longest row, the number of entries per row of the ELL storage.
+//
+Index_type SPMV::getEllWidth(const std::vector<Int_type>& row_ptr) const
+{
+  Index_type width = 0;
+  for (Index_type i = 0; i < m_num_rows; ++i) {
+    width = std::max(width, static_cast<Index_type>(row_ptr[i+1] - row_ptr[i]));
+  }
+  return width;
+}
+
+//
+// Row order and chunk lengths of the SELL storage, rows are sorted by length
+// within windows of sell_sort_rows rows and a chunk of sell_chunk_rows rows
+// is padded to its longest row.
+//
+void SPMV::makeSellChunks(const std::vector<Int_type>& row_ptr,
+                          std::vector<Int_type>& perm,
+                          std::vector<Int_type>& chunk_len) const
+{
+  auto row_len = [&](Index_type i) { return row_ptr[i+1] - row_ptr[i]; };
+
+  perm.resize(m_num_rows);
+  for (Index_type i = 0; i < m_num_rows; ++i) {
+    perm[i] = i;
+  }
+  for (Index_type w = 0; w < m_num_rows; w += sell_sort_rows) {
+    std::stable_sort(perm.begin() + w,
+                     perm.begin() + std::min(w + sell_sort_rows, m_num_rows),
+                     [&](Int_type a, Int_type b) { return row_len(a) > row_len(b); });
+  }
+
+  const Index_type num_chunks = (m_num_rows + sell_chunk_rows - 1) / sell_chunk_rows;
+
+  chunk_len.assign(num_chunks, 0);
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    for (Index_type r = 0; r < sell_chunk_rows; ++r) {
+      const Index_type row = c*sell_chunk_rows + r;
+      if ( row < m_num_rows ) {
+        chunk_len[c] = std::max(chunk_len[c], row_len(perm[row]));
+      }
+    }
+  }
+}
+
+void SPMV::setUp(VariantID vid, size_t tune_idx)
+{
+  std::vector<Int_type> row_ptr;
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+  makeMatrix(row_ptr, col, val);
+
+  allocAndInitDataRandValue(m_x, m_num_rows, vid);
+  allocAndInitDataConst(m_y, m_num_rows, 0.0, vid);
+
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "ell" ) {
+
+    m_ell_width = getEllWidth(row_ptr);
+
+    allocData(m_ell_col, m_ell_width*m_num_rows);
+    allocData(m_ell_val, m_ell_width*m_num_rows);
+    for (Index_type i = 0; i < m_num_rows; ++i) {
+      const Index_type row_len = row_ptr[i+1] - row_ptr[i];
+      for (Index_type k = 0; k < m_ell_width; ++k) {
+        m_ell_col[k*m_num_rows + i] = (k < row_len) ? col[row_ptr[i] + k] : i;
+        m_ell_val[k*m_num_rows + i] = (k < row_len) ? val[row_ptr[i] + k] : 0.0;
+      }
+    }
+
+  } else if ( tuning_name == "sell" ) {
+
+    auto row_len = [&](Index_type i) { return row_ptr[i+1] - row_ptr[i]; };
+
+    std::vector<Int_type> perm;
+    std::vector<Int_type> chunk_len;
+    makeSellChunks(row_ptr, perm, chunk_len);
+
+    const Index_type num_chunks = chunk_len.size();
+
+    allocData(m_sell_perm, m_num_rows);
+    allocData(m_sell_chunk_len, num_chunks);
+    allocData(m_sell_chunk_ptr, num_chunks+1);
+    std::copy(perm.begin(), perm.end(), m_sell_perm);
+    std::copy(chunk_len.begin(), chunk_len.end(), m_sell_chunk_len);
+
+    m_sell_chunk_ptr[0] = 0;
+    for (Index_type c = 0; c < num_chunks; ++c) {
+      m_sell_chunk_ptr[c+1] = m_sell_chunk_ptr[c] + chunk_len[c]*sell_chunk_rows;
+    }
+
+    allocData(m_sell_col, m_sell_chunk_ptr[num_chunks]);
+    allocData(m_sell_val, m_sell_chunk_ptr[num_chunks]);
+    for (Index_type c = 0; c < num_chunks; ++c) {
+      for (Index_type r = 0; r < sell_chunk_rows; ++r) {
+        const Index_type row = c*sell_chunk_rows + r;
+        const Index_type orig = (row < m_num_rows) ? perm[row] : 0;
+        const Index_type len = (row < m_num_rows) ? row_len(orig) : 0;
+        for (Index_type k = 0; k < m_sell_chunk_len[c]; ++k) {
+          const Index_type jk = m_sell_chunk_ptr[c] + k*sell_chunk_rows + r;
+          m_sell_col[jk] = (k < len) ? col[row_ptr[orig] + k] : orig;
+          m_sell_val[jk] = (k < len) ? val[row_ptr[orig] + k] : 0.0;
+        }
+      }
+    }
+
+  } else {
+
+    allocData(m_row_ptr, m_num_rows+1);
+    allocData(m_col, m_num_nonzeros);
+    allocData(m_val, m_num_nonzeros);
+    std::copy(row_ptr.begin(), row_ptr.end(), m_row_ptr);
+    std::copy(col.begin(), col.end(), m_col);
+    std::copy(val.begin(), val.end(), m_val);
+
+  }
+}
+
+void SPMV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_num_rows);
+}
+
+void SPMV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_row_ptr);
+  deallocData(m_col);
+  deallocData(m_val);
+  deallocData(m_ell_col);
+  deallocData(m_ell_val);
+  deallocData(m_sell_chunk_ptr);
+  deallocData(m_sell_chunk_len);
+  deallocData(m_sell_perm);
+  deallocData(m_sell_col);
+  deallocData(m_sell_val);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV kernel reference implementation:
+///
+/// // CSR storage
+/// for (Index_type i = 0; i < num_rows; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type j = row_ptr[i]; j < row_ptr[i+1]; ++j ) {
+///     dot += val[j] * x[col[j]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// The matrix is set with --spmv-matrix, a 7 or 27-point stencil on a 3D
+/// grid or a matrix with random columns and varying row lengths.
+///
+/// Tunings of the Base and RAJA variants using other storage:
+///
+///  "ell"   every row padded to the longest row, stored column by column
+///          so entry k of row i is at k*num_rows + i
+///
+///  "sell"  SELL-C-sigma, rows sorted by length within windows of
+///          sell_sort_rows rows and stored in chunks of sell_chunk_rows rows,
+///          each chunk padded to its longest row and stored column by column
+///
+/// Bytes and FLOPs per rep of the "ell" and "sell" tunings count their
+/// padded entries, the padding is loaded and multiplied like the others.
+///
+
+#ifndef RAJAPerf_Apps_SPMV_HPP
+#define RAJAPerf_Apps_SPMV_HPP
+
+#define SPMV_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  const Index_type num_rows = m_num_rows;
+
+#define SPMV_CSR_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_ELL_DATA_SETUP \
+  Int_ptr ell_col = m_ell_col; \
+  Real_ptr ell_val = m_ell_val; \
+  const Index_type ell_width = m_ell_width;
+
+#define SPMV_SELL_DATA_SETUP \
+  Int_ptr sell_chunk_ptr = m_sell_chunk_ptr; \
+  Int_ptr sell_chunk_len = m_sell_chunk_len; \
+  Int_ptr sell_perm = m_sell_perm; \
+  Int_ptr sell_col = m_sell_col; \
+  Real_ptr sell_val = m_sell_val; \
+  const Index_type sell_num_chunks = \
+    (num_rows + sell_chunk_rows - 1) / sell_chunk_rows;
+
+#define SPMV_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type j = row_ptr[i]; j < row_ptr[i+1]; ++j ) { \
+    dot += val[j] * x[col[j]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_ELL_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < ell_width; ++k ) { \
+    dot += ell_val[k*num_rows + i] * x[ell_col[k*num_rows + i]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_SELL_BODY \
+  Real_type dot[sell_chunk_rows]; \
+  for (Index_type r = 0; r < sell_chunk_rows; ++r ) { \
+    dot[r] = 0.0; \
+  } \
+  for (Index_type k = 0; k < sell_chunk_len[c]; ++k ) { \
+    const Index_type jk = sell_chunk_ptr[c] + k*sell_chunk_rows; \
+    for (Index_type r = 0; r < sell_chunk_rows; ++r ) { \
+      dot[r] += sell_val[jk + r] * x[sell_col[jk + r]]; \
+    } \
+  } \
+  for (Index_type r = 0; r < sell_chunk_rows; ++r ) { \
+    const Index_type row = c*sell_chunk_rows + r; \
+    if ( row < num_rows ) { \
+      y[sell_perm[row]] = dot[r]; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class SPMV : public KernelBase
+{
+public:
+
+  SPMV(const RunParams& params);
+
+  ~SPMV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantEll(VariantID vid);
+  void runSeqVariantSell(VariantID vid);
+  void runOpenMPVariantEll(VariantID vid);
+  void runOpenMPVariantSell(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  static const Index_type sell_chunk_rows = 8;
+  static const Index_type sell_sort_rows = 256;
+
+  void makeMatrix(std::vector<Int_type>& row_ptr,
+                  std::vector<Int_type>& col,
+                  std::vector<Real_type>& val) const;
+  Index_type getEllWidth(const std::vector<Int_type>& row_ptr) const;
+  void makeSellChunks(const std::vector<Int_type>& row_ptr,
+                      std::vector<Int_type>& perm,
+                      std::vector<Int_type>& chunk_len) const;
+
+  RunParams::SpmvMatrix m_matrix;
+  Index_type m_grid_size;
+  Index_type m_num_rows;
+  Index_type m_num_nonzeros;
+  Index_type m_ell_num_entries;
+  Index_type m_sell_num_entries;
+  Index_type m_ell_bytes_per_rep;
+  Index_type m_sell_bytes_per_rep;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Index_type m_ell_width;
+  Int_ptr m_ell_col;
+  Real_ptr m_ell_val;
+
+  Int_ptr m_sell_chunk_ptr;
+  Int_ptr m_sell_chunk_len;
+  Int_ptr m_sell_perm;
+  Int_ptr m_sell_col;
+  Real_ptr m_sell_val;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -20,8 +20,15 @@ namespace apps
 {
 
 
-void VOL3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx > 0 ) {
+
+    runSeqVariantUnstructured(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = m_domain->fpz;
   const Index_type iend = m_domain->lpz+1;
@@ -92,5 +99,69 @@ void VOL3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void VOL3D::runSeqVariantUnstructured(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_nzones;
+
+  VOL3D_UNSTRUCTURED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_UNSTRUCTURED_BODY_INDEX;
+          VOL3D_UNSTRUCTURED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          VOL3D_UNSTRUCTURED_BODY_INDEX;
+          VOL3D_UNSTRUCTURED_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void VOL3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    for (int io = 0; io < static_cast<int>(MeshOrdering::NumMeshOrderings); ++io) {
+      addVariantTuningName(vid, getMeshOrderingTuningName(static_cast<MeshOrdering>(io)));
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
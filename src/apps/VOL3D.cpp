@@ -13,7 +13,9 @@
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 
 namespace rajaperf
@@ -64,6 +66,15 @@ VOL3D::VOL3D(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  m_nzones = m_domain->lpz+1 - m_domain->fpz;
+  m_nnodes = 0;
+  m_zone_order = nullptr;
+  m_zone_nodes = nullptr;
+  m_node_x = nullptr;
+  m_node_y = nullptr;
+  m_node_z = nullptr;
+  m_zone_vol = nullptr;
 }
 
 VOL3D::~VOL3D()
@@ -71,7 +82,7 @@ VOL3D::~VOL3D()
   delete m_domain;
 }
 
-void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -85,10 +96,49 @@ void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   allocAndInitDataConst(m_vol, m_array_length, 0.0, vid);
 
   m_vnormq = 0.083333333333333333; /* vnormq = 1/12 */
+
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  for (int io = 0; io < static_cast<int>(MeshOrdering::NumMeshOrderings); ++io) {
+    MeshOrdering ordering = static_cast<MeshOrdering>(io);
+    if ( tuning_name != getMeshOrderingTuningName(ordering) ) continue;
+
+    std::vector<Index_type> zones(m_nzones);
+    for (Index_type iz = 0; iz < m_nzones; ++iz) {
+      zones[iz] = m_domain->fpz + iz;
+    }
+
+    UnstructuredMesh mesh;
+    setUnstructuredMesh(mesh, zones.data(), m_nzones, *m_domain, ordering);
+    m_nnodes = mesh.node_order.size();
+
+    allocData(m_zone_order, m_nzones);
+    allocData(m_zone_nodes, 8*m_nzones);
+    std::copy(mesh.zone_order.begin(), mesh.zone_order.end(), m_zone_order);
+    std::copy(mesh.zone_nodes.begin(), mesh.zone_nodes.end(), m_zone_nodes);
+
+    allocData(m_node_x, m_nnodes);
+    allocData(m_node_y, m_nnodes);
+    allocData(m_node_z, m_nnodes);
+    for (Index_type n = 0; n < m_nnodes; ++n) {
+      m_node_x[n] = m_x[mesh.node_order[n]];
+      m_node_y[n] = m_y[mesh.node_order[n]];
+      m_node_z[n] = m_z[mesh.node_order[n]];
+    }
+
+    allocAndInitDataConst(m_zone_vol, m_nzones, 0.0, vid);
+  }
 }
 
 void VOL3D::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( m_zone_vol != nullptr ) {
+    // checksum the zones in the numbering of the domain
+    for (Index_type iz = 0; iz < m_nzones; ++iz) {
+      m_vol[m_zone_order[iz]] = m_zone_vol[iz];
+    }
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_vol, m_array_length, checksum_scale_factor );
 }
 
@@ -100,6 +150,12 @@ void VOL3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_y);
   deallocData(m_z);
   deallocData(m_vol);
+  deallocData(m_zone_order);
+  deallocData(m_zone_nodes);
+  deallocData(m_node_x);
+  deallocData(m_node_y);
+  deallocData(m_node_z);
+  deallocData(m_zone_vol);
 }
 
 } // end namespace apps
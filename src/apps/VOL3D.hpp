@@ -65,6 +65,13 @@
 ///   vol[i] *= vnormq ;
 /// }
 ///
+/// The "unstructured*" tunings of the Base and RAJA host variants store the
+/// mesh as an unstructured mesh, zone i reads its nodes through the zone to
+/// node connectivity (zone_nodes[8*i + c] replaces x0..x7 etc.). The zones and
+/// nodes are numbered in lexicographic, random, Morton, Hilbert or reverse
+/// Cuthill-McKee order, see MeshOrdering in AppsData.hpp. Bytes per rep do
+/// not include the connectivity.
+///
 
 #ifndef RAJAPerf_Apps_VOL3D_HPP
 #define RAJAPerf_Apps_VOL3D_HPP
@@ -141,6 +148,86 @@
  \
   vol[i] *= vnormq ;
 
+#define VOL3D_UNSTRUCTURED_DATA_SETUP \
+  Real_ptr x = m_node_x; \
+  Real_ptr y = m_node_y; \
+  Real_ptr z = m_node_z; \
+  Real_ptr vol = m_zone_vol; \
+  Int_ptr zone_nodes = m_zone_nodes; \
+\
+  const Real_type vnormq = m_vnormq;
+
+#define VOL3D_UNSTRUCTURED_BODY_INDEX \
+  const Index_type n0 = zone_nodes[8*i + 0] ; \
+  const Index_type n1 = zone_nodes[8*i + 1] ; \
+  const Index_type n2 = zone_nodes[8*i + 2] ; \
+  const Index_type n3 = zone_nodes[8*i + 3] ; \
+  const Index_type n4 = zone_nodes[8*i + 4] ; \
+  const Index_type n5 = zone_nodes[8*i + 5] ; \
+  const Index_type n6 = zone_nodes[8*i + 6] ; \
+  const Index_type n7 = zone_nodes[8*i + 7] ;
+
+#define VOL3D_UNSTRUCTURED_BODY \
+  Real_type x71 = x[n7] - x[n1] ; \
+  Real_type x72 = x[n7] - x[n2] ; \
+  Real_type x74 = x[n7] - x[n4] ; \
+  Real_type x30 = x[n3] - x[n0] ; \
+  Real_type x50 = x[n5] - x[n0] ; \
+  Real_type x60 = x[n6] - x[n0] ; \
+ \
+  Real_type y71 = y[n7] - y[n1] ; \
+  Real_type y72 = y[n7] - y[n2] ; \
+  Real_type y74 = y[n7] - y[n4] ; \
+  Real_type y30 = y[n3] - y[n0] ; \
+  Real_type y50 = y[n5] - y[n0] ; \
+  Real_type y60 = y[n6] - y[n0] ; \
+ \
+  Real_type z71 = z[n7] - z[n1] ; \
+  Real_type z72 = z[n7] - z[n2] ; \
+  Real_type z74 = z[n7] - z[n4] ; \
+  Real_type z30 = z[n3] - z[n0] ; \
+  Real_type z50 = z[n5] - z[n0] ; \
+  Real_type z60 = z[n6] - z[n0] ; \
+ \
+  Real_type xps = x71 + x60 ; \
+  Real_type yps = y71 + y60 ; \
+  Real_type zps = z71 + z60 ; \
+ \
+  Real_type cyz = y72 * z30 - z72 * y30 ; \
+  Real_type czx = z72 * x30 - x72 * z30 ; \
+  Real_type cxy = x72 * y30 - y72 * x30 ; \
+  vol[i] = xps * cyz + yps * czx + zps * cxy ; \
+ \
+  xps = x72 + x50 ; \
+  yps = y72 + y50 ; \
+  zps = z72 + z50 ; \
+ \
+  cyz = y74 * z60 - z74 * y60 ; \
+  czx = z74 * x60 - x74 * z60 ; \
+  cxy = x74 * y60 - y74 * x60 ; \
+  vol[i] += xps * cyz + yps * czx + zps * cxy ; \
+ \
+  xps = x74 + x30 ; \
+  yps = y74 + y30 ; \
+  zps = z74 + z30 ; \
+ \
+  cyz = y74 * z60 - z74 * y60 ; \
+  czx = z74 * x60 - x74 * z60 ; \
+  cxy = x74 * y60 - y74 * x60 ; \
+  vol[i] += xps * cyz + yps * czx + zps * cxy ; \
+ \
+  xps = x74 + x30 ; \
+  yps = y74 + y30 ; \
+  zps = z74 + z30 ; \
+ \
+  cyz = y71 * z50 - z71 * y50 ; \
+  czx = z71 * x50 - x71 * z50 ; \
+  cxy = x71 * y50 - y71 * x50 ; \
+  vol[i] += xps * cyz + yps * czx + zps * cxy ; \
+ \
+  vol[i] *= vnormq ;
+
+
 
 #include "common/KernelBase.hpp"
 
@@ -170,12 +257,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  void runSeqVariantUnstructured(VariantID vid);
+  void runOpenMPVariantUnstructured(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -190,6 +281,15 @@ private:
 
   ADomain* m_domain;
   Index_type m_array_length;
+
+  Index_type m_nzones;
+  Index_type m_nnodes;
+  Int_ptr m_zone_order;
+  Int_ptr m_zone_nodes;
+  Real_ptr m_node_x;
+  Real_ptr m_node_y;
+  Real_ptr m_node_z;
+  Real_ptr m_zone_vol;
 };
 
 } // end namespace apps
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/MixedPrecisionDataUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +20,18 @@ namespace basic
 {
 
 
-void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantStorage<float>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantStorage<BFloat16>(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -88,8 +98,80 @@ void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < typename StorageT >
+void DAXPY::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_DATA_SETUP_STORAGE(StorageT);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DAXPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DAXPY_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  DAXPY_DATA_TEARDOWN_STORAGE;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DAXPY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "float",
+                         getStorageChecksumTolerance<float>());
+    addVariantTuningName(vid, "bfloat16",
+                         getStorageChecksumTolerance<BFloat16>());
+    setStorageBytesPerRep(vid);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
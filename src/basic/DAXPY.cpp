@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 namespace rajaperf
 {
@@ -57,6 +58,20 @@ DAXPY::~DAXPY()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the x array is kept in the storage
+// type.
+//
+void DAXPY::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (1*sizeof(Real_type) + 1*sizeof(Real_type) + 1*storage_size) * getActualProblemSize() );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void DAXPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
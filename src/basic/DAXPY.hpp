@@ -25,6 +25,15 @@
 #define DAXPY_BODY  \
   y[i] += a * x[i] ;
 
+#define DAXPY_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* x; \
+  Real_ptr y = m_y; \
+  Real_type a = m_a; \
+  allocAndInitStorageData(x, m_x, iend, vid);
+
+#define DAXPY_DATA_TEARDOWN_STORAGE \
+  deallocStorageData(x);
+
 
 #include "common/KernelBase.hpp"
 
@@ -53,8 +62,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -64,6 +79,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_type m_a;
@@ -18,10 +18,18 @@ namespace basic
 {
 
 
-void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantChunk<1>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantChunk<cacheline_reals>(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -90,10 +98,78 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+template < int chunk_size >
+void DAXPY_ATOMIC::runOpenMPVariantChunk(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_ATOMIC_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(static, chunk_size)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          y[i] += a * x[i] ;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_static_exec<chunk_size>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DAXPY_ATOMIC_RAJA_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void DAXPY_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "interleaved");
+    addVariantTuningName(vid, "per_cacheline");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -13,6 +13,13 @@
 ///   y[i] += a * x[i] ;
 /// }
 ///
+/// The Base and RAJA OpenMP variants have tunings that vary the contention
+/// on the cache lines of y by the static schedule chunk size:
+///
+///  "interleaved"   chunks of 1, each cache line is updated by many threads
+///  "per_cacheline" chunks of a cache line, each cache line is updated by
+///                  one thread while threads are still finely interleaved
+///
 
 #ifndef RAJAPerf_Basic_DAXPY_ATOMIC_HPP
 #define RAJAPerf_Basic_DAXPY_ATOMIC_HPP
@@ -56,8 +63,11 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < int chunk_size >
+  void runOpenMPVariantChunk(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -67,6 +77,9 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // number of Real_type values in an aligned cache line
+  static const int cacheline_reals = RAJA::DATA_ALIGN / sizeof(Real_type);
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_type m_a;
@@ -18,8 +18,13 @@ namespace basic
 {
 
 
-void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void IF_QUAD::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantSelect(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -86,5 +91,67 @@ void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void IF_QUAD::runSeqVariantSelect(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  auto ifquad_lam = [=](Index_type i) {
+                      IF_QUAD_SELECT_BODY;
+                    };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_SELECT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), ifquad_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void IF_QUAD::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "select");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -21,6 +21,9 @@
 ///   }
 /// }
 ///
+/// The "select" tuning computes both roots from sqrt of s clamped to zero
+/// and selects them or zero, so the loop body has no branch.
+///
 
 #ifndef RAJAPerf_Basic_IF_QUAD_HPP
 #define RAJAPerf_Basic_IF_QUAD_HPP
@@ -43,6 +46,14 @@
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_SELECT_BODY  \
+  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+  Real_type sq = sqrt( s >= 0.0 ? s : 0.0 ); \
+  Real_type r2 = (-b[i]+sq)/(2.0*a[i]); \
+  Real_type r1 = (-b[i]-sq)/(2.0*a[i]); \
+  x2[i] = ( s >= 0.0 ) ? r2 : 0.0; \
+  x1[i] = ( s >= 0.0 ) ? r1 : 0.0;
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -70,8 +81,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantSelect(VariantID vid);
+  void runOpenMPVariantSelect(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
+#include <vector>
 #include <iostream>
 
 namespace rajaperf
@@ -17,10 +19,34 @@ namespace rajaperf
 namespace basic
 {
 
-void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantBitmask(vid);
+    return;
+
+  } else if ( tune_idx == 2 ) {
+
+    runOpenMPVariantLookback(vid);
+    return;
+
+  } else if ( tune_idx == 3 ) {
+
+    runOpenMPVariantLocalBuffers(vid);
+    return;
+
+  } else if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                                      prefetch_distances_type>(
+                getVariantTuningName(vid, tune_idx),
+                [&](auto distance) { runOpenMPVariantPrefetch<distance>(vid); }) ) {
+
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -198,10 +224,418 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+//
+// Each thread sets one bit per element of its part of the range and counts
+// the set bits with popcount, then expands the set bits into the list at
+// the offset given by the counts of the preceding threads.
+//
+void INDEXLIST::runOpenMPVariantBitmask(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nwords = bitmask::num_words(iend - ibegin);
+      ::std::vector<bitmask::word_type> masks(nwords);
+      // at least one thread so an empty problem does not ask for num_threads(0)
+      const int p0 = static_cast<int>(std::max(std::min(nwords, static_cast<Index_type>(omp_get_max_threads())),
+                                               static_cast<Index_type>(1)));
+      ::std::vector<Index_type> thread_sums(p0);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+
+        #pragma omp parallel num_threads(p0)
+        {
+          const int p = omp_get_num_threads();
+          const int pid = omp_get_thread_num();
+          const Index_type step = nwords / p;
+          const Index_type local_begin = pid * step;
+          const Index_type local_end = (pid == p-1) ? nwords : (pid+1) * step;
+
+          Index_type local_sum_var = 0;
+          for (Index_type w = local_begin; w < local_end; ++w) {
+            const Index_type wbegin = ibegin + w * bitmask::word_bits;
+            const Index_type wend = std::min(wbegin + bitmask::word_bits, iend);
+
+            bitmask::word_type mask = 0;
+            for (Index_type i = wbegin; i < wend; ++i ) {
+              mask |= static_cast<bitmask::word_type>(INDEXLIST_CONDITIONAL) << (i - wbegin);
+            }
+            masks[w] = mask;
+            local_sum_var += bitmask::popcount(mask);
+          }
+          thread_sums[pid] = local_sum_var;
+
+          #pragma omp barrier
+
+          Index_type local_count_var = 0;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_count_var += thread_sums[ip];
+          }
+
+          for (Index_type w = local_begin; w < local_end; ++w) {
+            const Index_type wbegin = ibegin + w * bitmask::word_bits;
+            for (bitmask::word_type mask = masks[w]; mask != 0; mask &= mask - 1) {
+              list[local_count_var++] = wbegin + bitmask::lowest_bit(mask);
+            }
+          }
+
+          if (pid == p-1) {
+            count = local_count_var;
+          }
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      ignore_unused(run_reps, ibegin, iend, x, list);
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Single pass compaction with decoupled lookback. Threads take chunks in
+// order, count the chunk, and publish the count. The chunk's offset in the
+// list is found by looking back at the preceding chunks until one with an
+// inclusive prefix is found, then the chunk's inclusive prefix is published
+// and the chunk is compacted into the list while it is still in cache.
+//
+void INDEXLIST::runOpenMPVariantLookback(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // chunk status is (value << 2) | flag where flag is
+      // 0 not ready, 1 value is the chunk count, 2 value is the inclusive prefix
+      const Index_type status_aggregate = 1;
+      const Index_type status_prefix = 2;
+
+      const Index_type nchunks = (iend - ibegin + lookback_chunk_size - 1) / lookback_chunk_size;
+      ::std::vector<Index_type> chunk_status_vec(nchunks);
+      Index_type* chunk_status = chunk_status_vec.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+        Index_type next_chunk = 0;
+
+        for (Index_type c = 0; c < nchunks; ++c) {
+          chunk_status[c] = 0;
+        }
+
+        #pragma omp parallel
+        {
+          while (true) {
+
+            Index_type c;
+            #pragma omp atomic capture
+            c = next_chunk++;
+
+            if (c >= nchunks) {
+              break;
+            }
+
+            const Index_type cbegin = ibegin + c * lookback_chunk_size;
+            const Index_type cend = std::min(cbegin + lookback_chunk_size, iend);
+
+            Index_type local_sum_var = 0;
+            for (Index_type i = cbegin; i < cend; ++i ) {
+              local_sum_var += (INDEXLIST_CONDITIONAL) ? 1 : 0;
+            }
+
+            Index_type status = (local_sum_var << 2) |
+                                (c == 0 ? status_prefix : status_aggregate);
+            #pragma omp atomic write seq_cst
+            chunk_status[c] = status;
+
+            Index_type local_count_var = 0;
+            Index_type lc = c - 1;
+            while (lc >= 0) {
+              Index_type lstatus;
+              #pragma omp atomic read seq_cst
+              lstatus = chunk_status[lc];
+              if (lstatus == 0) {
+                continue;
+              }
+              local_count_var += lstatus >> 2;
+              if ((lstatus & 3) == status_prefix) {
+                break;
+              }
+              --lc;
+            }
+
+            if (c > 0) {
+              status = ((local_count_var + local_sum_var) << 2) | status_prefix;
+              #pragma omp atomic write seq_cst
+              chunk_status[c] = status;
+            }
+
+            for (Index_type i = cbegin; i < cend; ++i ) {
+              if (INDEXLIST_CONDITIONAL) {
+                list[local_count_var++] = i ;
+              }
+            }
+
+            if (c == nchunks-1) {
+              count = local_count_var;
+            }
+          }
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      ignore_unused(run_reps, ibegin, iend, x, list);
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread compacts its part of the range into a local buffer, then the
+// buffers are copied into the list at the offsets given by the sizes of
+// the preceding buffers.
+//
+void INDEXLIST::runOpenMPVariantLocalBuffers(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type n = iend - ibegin;
+      // at least one thread so an empty problem does not ask for num_threads(0)
+      const int p0 = static_cast<int>(std::max(std::min(n, static_cast<Index_type>(omp_get_max_threads())),
+                                               static_cast<Index_type>(1)));
+      ::std::vector<Index_type> thread_sums(p0);
+      ::std::vector<::std::vector<Int_type>> thread_lists(p0);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+
+        #pragma omp parallel num_threads(p0)
+        {
+          const int p = omp_get_num_threads();
+          const int pid = omp_get_thread_num();
+          const Index_type step = n / p;
+          const Index_type local_begin = pid * step + ibegin;
+          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+
+          // take the buffer so its size is not updated in a shared cache line,
+          // its storage is reused by the following reps
+          ::std::vector<Int_type> local_list;
+          local_list.swap(thread_lists[pid]);
+          local_list.clear();
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            if (INDEXLIST_CONDITIONAL) {
+              local_list.push_back(i);
+            }
+          }
+          thread_sums[pid] = local_list.size();
+
+          #pragma omp barrier
+
+          Index_type local_count_var = 0;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_count_var += thread_sums[ip];
+          }
+
+          std::copy(local_list.begin(), local_list.end(), list + local_count_var);
+
+          if (pid == p-1) {
+            count = local_count_var + thread_sums[pid];
+          }
+
+          local_list.swap(thread_lists[pid]);
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      ignore_unused(run_reps, ibegin, iend, x, list);
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Two pass scan of the default Base variant without OpenMP 5 scan, the
+// first pass prefetches x and the second pass prefetches the list.
+//
+template < size_t distance >
+void INDEXLIST::runOpenMPVariantPrefetch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type n = iend - ibegin;
+      ::std::vector<Index_type> tmp_scan(n);
+      // at least one thread so an empty problem does not ask for num_threads(0)
+      const int p0 = static_cast<int>(std::max(std::min(n, static_cast<Index_type>(omp_get_max_threads())),
+                                               static_cast<Index_type>(1)));
+      ::std::vector<Index_type> thread_sums(p0);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+
+        #pragma omp parallel num_threads(p0)
+        {
+          const int p = omp_get_num_threads();
+          const int pid = omp_get_thread_num();
+          const Index_type step = n / p;
+          const Index_type local_begin = pid * step + ibegin;
+          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+
+          Index_type local_sum_var = 0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+
+            INDEXLIST_PREFETCH_INPUT(distance);
+            Index_type inc = 0;
+            if (INDEXLIST_CONDITIONAL) {
+              inc = 1;
+            }
+            tmp_scan[i] = inc;
+            local_sum_var += inc;
+          }
+          thread_sums[pid] = local_sum_var;
+
+          #pragma omp barrier
+
+          Index_type local_count_var = 0;
+          for (int ip = 0; ip < pid; ++ip) {
+            local_count_var += thread_sums[ip];
+          }
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            INDEXLIST_PREFETCH_OUTPUT(local_count_var, distance);
+            Index_type inc = tmp_scan[i];
+            if (inc) {
+              list[local_count_var] = i ;
+            }
+            local_count_var += inc;
+          }
+
+          if (pid == p-1) {
+            count = local_count_var;
+          }
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "bitmask");
+    addVariantTuningName(vid, "lookback");
+    addVariantTuningName(vid, "local_buffers");
+  }
+
+  if ( vid == Base_OpenMP && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
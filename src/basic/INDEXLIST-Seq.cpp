@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +19,22 @@ namespace basic
 {
 
 
-void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+
+    runSeqVariantBitmask(vid);
+    return;
+
+  } else if ( host_tuning::run_tuning<host_tuning::prefetch_distance,
+                                      prefetch_distances_type>(
+                getVariantTuningName(vid, tune_idx),
+                [&](auto distance) { runSeqVariantPrefetch<distance>(vid); }) ) {
+
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -80,5 +95,111 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+//
+// Set one bit per element in a word, then expand the set bits of the word.
+//
+void INDEXLIST::runSeqVariantBitmask(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  const Index_type nwords = bitmask::num_words(iend - ibegin);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+
+        for (Index_type w = 0; w < nwords; ++w) {
+          const Index_type wbegin = ibegin + w * bitmask::word_bits;
+          const Index_type wend = std::min(wbegin + bitmask::word_bits, iend);
+
+          bitmask::word_type mask = 0;
+          for (Index_type i = wbegin; i < wend; ++i ) {
+            mask |= static_cast<bitmask::word_type>(INDEXLIST_CONDITIONAL) << (i - wbegin);
+          }
+
+          for ( ; mask != 0; mask &= mask - 1) {
+            list[count++] = wbegin + bitmask::lowest_bit(mask);
+          }
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t distance >
+void INDEXLIST::runSeqVariantPrefetch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = 0;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INDEXLIST_PREFETCH_INPUT(distance);
+          INDEXLIST_PREFETCH_OUTPUT(count, distance);
+          INDEXLIST_BODY;
+        }
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void INDEXLIST::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantTuningName(vid, "bitmask");
+  }
+
+  if ( vid == Base_Seq && prefetch::available ) {
+    addVariantHostTuningNames<host_tuning::prefetch_distance,
+                              prefetch_distances_type>(vid);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
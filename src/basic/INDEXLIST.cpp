@@ -26,10 +26,12 @@ INDEXLIST::INDEXLIST(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_selectivity = params.getSelectivity();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 + // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() * m_selectivity +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep(0);
 
@@ -57,7 +59,10 @@ INDEXLIST::~INDEXLIST()
 
 void INDEXLIST::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    m_x[i] -= m_selectivity;
+  }
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
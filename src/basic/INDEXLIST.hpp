@@ -17,6 +17,23 @@
 /// }
 /// Index_type len = count;
 ///
+/// The fraction of x[i] that are negative is set with --selectivity.
+///
+/// Stream compaction tunings:
+///
+///  "bitmask"        (Base Seq/OpenMP) one bit per element is set in a
+///                   bitmask and counted with popcount, then the set bits
+///                   are expanded into the list
+///  "lookback"       (Base OpenMP) single pass, threads take chunks in order
+///                   and get the chunk's list offset by looking back at the
+///                   counts published by the preceding chunks
+///  "local_buffers"  (Base OpenMP) each thread compacts its part of the range
+///                   into a local buffer, the buffers are concatenated
+///
+///  "prefetch_<N>"   (Base Seq/OpenMP) prefetches x N iterations ahead and
+///                   the list N entries past the next output, see the
+///                   prefetch namespace in HostUtils.hpp
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_HPP
 #define RAJAPerf_Basic_INDEXLIST_HPP
@@ -33,6 +50,16 @@
     list[count++] = i ; \
   }
 
+#define INDEXLIST_PREFETCH_INPUT(distance) \
+  if ( i + distance < iend ) { \
+    prefetch::read(&x[i + distance]); \
+  }
+
+#define INDEXLIST_PREFETCH_OUTPUT(count, distance) \
+  if ( count + distance < iend ) { \
+    prefetch::write(&list[count + distance]); \
+  }
+
 
 #include "common/KernelBase.hpp"
 
@@ -61,8 +88,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantBitmask(VariantID vid);
+  void runOpenMPVariantBitmask(VariantID vid);
+  void runOpenMPVariantLookback(VariantID vid);
+  void runOpenMPVariantLocalBuffers(VariantID vid);
+  template < size_t distance >
+  void runSeqVariantPrefetch(VariantID vid);
+  template < size_t distance >
+  void runOpenMPVariantPrefetch(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -71,10 +108,16 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  using prefetch_distances_type = host_tuning::make_list_type<host_tuning::prefetch_distance,
+                                                              host_tuning::list_type<64, 256, 1024>>;
+
+  static const Index_type lookback_chunk_size = 4096;
 
   Real_ptr m_x;
   Int_ptr m_list;
   Index_type m_len;
+
+  Real_type m_selectivity;
 };
 
 } // end namespace basic
@@ -23,11 +23,27 @@ namespace basic
 #define INDEXLIST_3LOOP_DATA_TEARDOWN_OMP \
   delete[] counts; counts = nullptr;
 
+#define INDEXLIST_3LOOP_BITMASK_DATA_SETUP_OMP \
+  bitmask::word_type* masks = new bitmask::word_type[nwords]; \
+  Index_type* counts = new Index_type[nwords+1]; \
+  counts[nwords] = 0;
 
-void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+#define INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_OMP \
+  delete[] masks; masks = nullptr; \
+  delete[] counts; counts = nullptr;
+
+
+void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantBitmask(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -239,10 +255,117 @@ void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+//
+// One bit per element in place of counts, the scan is over the per word
+// counts of set bits. There are word_bits times fewer of those than counts
+// so the Base variant scans them serially.
+//
+void INDEXLIST_3LOOP::runOpenMPVariantBitmask(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_3LOOP_DATA_SETUP;
+
+  const Index_type nwords = bitmask::num_words(iend - ibegin);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      INDEXLIST_3LOOP_BITMASK_DATA_SETUP_OMP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type w = 0; w < nwords; ++w) {
+          INDEXLIST_3LOOP_BITMASK_CONDITIONAL;
+        }
+
+        Index_type count = 0;
+
+        for (Index_type w = 0; w < nwords+1; ++w) {
+          Index_type inc = counts[w];
+          counts[w] = count;
+          count += inc;
+        }
+
+        #pragma omp parallel for
+        for (Index_type w = 0; w < nwords; ++w) {
+          INDEXLIST_3LOOP_BITMASK_MAKE_LIST;
+        }
+
+        m_len = counts[nwords];
+
+      }
+      stopTimer();
+
+      INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_OMP;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      INDEXLIST_3LOOP_BITMASK_DATA_SETUP_OMP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nwords),
+          [=](Index_type w) {
+          INDEXLIST_3LOOP_BITMASK_CONDITIONAL;
+        });
+
+        RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+            RAJA::make_span(counts, nwords+1));
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nwords),
+          [=](Index_type w) {
+          INDEXLIST_3LOOP_BITMASK_MAKE_LIST;
+        });
+
+        m_len = counts[nwords];
+
+      }
+      stopTimer();
+
+      INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_OMP;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST_3LOOP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void INDEXLIST_3LOOP::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "bitmask");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
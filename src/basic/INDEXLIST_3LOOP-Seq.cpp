@@ -23,10 +23,26 @@ namespace basic
 #define INDEXLIST_3LOOP_DATA_TEARDOWN_Seq \
   delete[] counts; counts = nullptr;
 
+#define INDEXLIST_3LOOP_BITMASK_DATA_SETUP_Seq \
+  bitmask::word_type* masks = new bitmask::word_type[nwords]; \
+  Index_type* counts = new Index_type[nwords+1]; \
+  counts[nwords] = 0;
+
+#define INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_Seq \
+  delete[] masks; masks = nullptr; \
+  delete[] counts; counts = nullptr;
+
 
 
-void INDEXLIST_3LOOP::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST_3LOOP::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+
+    runSeqVariantBitmask(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -156,5 +172,105 @@ void INDEXLIST_3LOOP::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
 }
 
+//
+// One bit per element in place of counts, the scan is over the per word
+// counts of set bits.
+//
+void INDEXLIST_3LOOP::runSeqVariantBitmask(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_3LOOP_DATA_SETUP;
+
+  const Index_type nwords = bitmask::num_words(iend - ibegin);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      INDEXLIST_3LOOP_BITMASK_DATA_SETUP_Seq;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 0; w < nwords; ++w) {
+          INDEXLIST_3LOOP_BITMASK_CONDITIONAL;
+        }
+
+        Index_type count = 0;
+
+        for (Index_type w = 0; w < nwords+1; ++w) {
+          Index_type inc = counts[w];
+          counts[w] = count;
+          count += inc;
+        }
+
+        for (Index_type w = 0; w < nwords; ++w) {
+          INDEXLIST_3LOOP_BITMASK_MAKE_LIST;
+        }
+
+        m_len = counts[nwords];
+
+      }
+      stopTimer();
+
+      INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_Seq;
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      INDEXLIST_3LOOP_BITMASK_DATA_SETUP_Seq;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nwords),
+          [=](Index_type w) {
+          INDEXLIST_3LOOP_BITMASK_CONDITIONAL;
+        });
+
+        RAJA::exclusive_scan_inplace<RAJA::loop_exec>(
+            RAJA::make_span(counts, nwords+1));
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nwords),
+          [=](Index_type w) {
+          INDEXLIST_3LOOP_BITMASK_MAKE_LIST;
+        });
+
+        m_len = counts[nwords];
+
+      }
+      stopTimer();
+
+      INDEXLIST_3LOOP_BITMASK_DATA_TEARDOWN_Seq;
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  INDEXLIST_3LOOP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void INDEXLIST_3LOOP::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "bitmask");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -26,6 +26,8 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
 
   setActualProblemSize( getTargetProblemSize() );
 
+  m_selectivity = params.getSelectivity();
+
   setItsPerRep( 3 * getActualProblemSize() + 1 );
   setKernelsPerRep(3);
   setBytesPerRep( (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() +
@@ -35,7 +37,7 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
                   (1*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
 
                   (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 ); // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() * m_selectivity );
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -66,7 +68,10 @@ INDEXLIST_3LOOP::~INDEXLIST_3LOOP()
 
 void INDEXLIST_3LOOP::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    m_x[i] -= m_selectivity;
+  }
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
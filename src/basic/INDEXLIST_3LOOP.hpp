@@ -28,6 +28,13 @@
 ///
 /// Index_type len = counts[iend];
 ///
+/// The fraction of x[i] that are negative is set with --selectivity.
+///
+/// The "bitmask" tuning (Base/RAJA Seq/OpenMP) keeps one bit per element in
+/// place of counts, the first loop sets the bits and counts them with
+/// popcount per word, the scan is over the per word counts, and the last
+/// loop expands the set bits of each word into the list.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
 #define RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
@@ -44,6 +51,23 @@
     list[counts[i]] = i ; \
   }
 
+#define INDEXLIST_3LOOP_BITMASK_CONDITIONAL \
+  const Index_type wbegin = ibegin + w * bitmask::word_bits; \
+  const Index_type wend = RAJA_MIN(wbegin + bitmask::word_bits, iend); \
+  bitmask::word_type mask = 0; \
+  for (Index_type i = wbegin; i < wend; ++i ) { \
+    mask |= static_cast<bitmask::word_type>(INDEXLIST_3LOOP_CONDITIONAL) << (i - wbegin); \
+  } \
+  masks[w] = mask; \
+  counts[w] = bitmask::popcount(mask);
+
+#define INDEXLIST_3LOOP_BITMASK_MAKE_LIST \
+  const Index_type wbegin = ibegin + w * bitmask::word_bits; \
+  Index_type count = counts[w]; \
+  for (bitmask::word_type mask = masks[w]; mask != 0; mask &= mask - 1) { \
+    list[count++] = wbegin + bitmask::lowest_bit(mask); \
+  }
+
 
 #include "common/KernelBase.hpp"
 
@@ -72,8 +96,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantBitmask(VariantID vid);
+  void runOpenMPVariantBitmask(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -86,6 +114,8 @@ private:
   Real_ptr m_x;
   Int_ptr m_list;
   Index_type m_len;
+
+  Real_type m_selectivity;
 };
 
 } // end namespace basic
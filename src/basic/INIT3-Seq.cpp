@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/MixedPrecisionDataUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,8 +20,16 @@ namespace basic
 {
 
 
-void INIT3::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INIT3::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantStorage<float>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runSeqVariantStorage<BFloat16>(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -86,5 +96,71 @@ void INIT3::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < typename StorageT >
+void INIT3::runSeqVariantStorage(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INIT3_DATA_SETUP_STORAGE(StorageT);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INIT3_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          INIT3_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  INIT3 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  INIT3_DATA_TEARDOWN_STORAGE;
+}
+
+void INIT3::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "float",
+                         getStorageChecksumTolerance<float>());
+    addVariantTuningName(vid, "bfloat16",
+                         getStorageChecksumTolerance<BFloat16>());
+    setStorageBytesPerRep(vid);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
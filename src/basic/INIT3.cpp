@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 namespace rajaperf
 {
@@ -57,6 +58,20 @@ INIT3::~INIT3()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the out and in arrays are kept in the
+// storage type.
+//
+void INIT3::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (3*storage_size + 2*storage_size) * getActualProblemSize() );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void INIT3::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, vid);
@@ -15,16 +15,19 @@
 namespace rajaperf {
 namespace basic {
 
-void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < size_t host_tile_size_ >
+void MAT_MAT_SHARED::runOpenMPVariantImpl(VariantID vid) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  constexpr Index_type tile_size = host_tile_size_;
+
   const Index_type run_reps = getRunReps();
   const Index_type N = m_N;
 
   MAT_MAT_SHARED_DATA_SETUP;
 
-  const Index_type Nx = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
-  const Index_type Ny = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
+  const Index_type Nx = RAJA_DIVIDE_CEILING_INT(N, tile_size);
+  const Index_type Ny = RAJA_DIVIDE_CEILING_INT(N, tile_size);
 
   switch (vid) {
 
@@ -39,34 +42,34 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
         for (Index_type by = 0; by < Ny; ++by) {
           for (Index_type bx = 0; bx < Nx; ++bx) {
 
-            MAT_MAT_SHARED_BODY_0(TL_SZ)
+            MAT_MAT_SHARED_BODY_0(tile_size)
 
-            for (Index_type ty = 0; ty < TL_SZ; ++ty) {
-              for (Index_type tx = 0; tx < TL_SZ; ++tx) {
-                MAT_MAT_SHARED_BODY_1(TL_SZ)
+            for (Index_type ty = 0; ty < tile_size; ++ty) {
+              for (Index_type tx = 0; tx < tile_size; ++tx) {
+                MAT_MAT_SHARED_BODY_1(tile_size)
               }
             }
 
-            for (Index_type k = 0; k < (TL_SZ + N - 1) / TL_SZ; ++k) {
+            for (Index_type k = 0; k < (tile_size + N - 1) / tile_size; ++k) {
 
-              for (Index_type ty = 0; ty < TL_SZ; ++ty) {
-                for (Index_type tx = 0; tx < TL_SZ; ++tx) {
+              for (Index_type ty = 0; ty < tile_size; ++ty) {
+                for (Index_type tx = 0; tx < tile_size; ++tx) {
 
-                  MAT_MAT_SHARED_BODY_2(TL_SZ)
+                  MAT_MAT_SHARED_BODY_2(tile_size)
                 }
               }
 
-              for (Index_type ty = 0; ty < TL_SZ; ++ty) {
-                for (Index_type tx = 0; tx < TL_SZ; ++tx) {
+              for (Index_type ty = 0; ty < tile_size; ++ty) {
+                for (Index_type tx = 0; tx < tile_size; ++tx) {
 
-                  MAT_MAT_SHARED_BODY_3(TL_SZ)
+                  MAT_MAT_SHARED_BODY_3(tile_size)
                 }
               }
             }
 
-            for (Index_type ty = 0; ty < TL_SZ; ++ty) {
-              for (Index_type tx = 0; tx < TL_SZ; ++tx) {
-                MAT_MAT_SHARED_BODY_4(TL_SZ)
+            for (Index_type ty = 0; ty < tile_size; ++ty) {
+              for (Index_type tx = 0; tx < tile_size; ++tx) {
+                MAT_MAT_SHARED_BODY_4(tile_size)
               }
             }
           }
@@ -85,58 +88,58 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
       auto outer_y = [&](Index_type by) {
         auto outer_x = [&](Index_type bx) {
-          MAT_MAT_SHARED_BODY_0(TL_SZ)
+          MAT_MAT_SHARED_BODY_0(tile_size)
 
           auto inner_y_1 = [&](Index_type ty) {
-            auto inner_x_1 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_1(TL_SZ) };
+            auto inner_x_1 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_1(tile_size) };
 
-            for (Index_type tx = 0; tx < TL_SZ; ++tx) {
-              if (tx < TL_SZ)
+            for (Index_type tx = 0; tx < tile_size; ++tx) {
+              if (tx < tile_size)
                 inner_x_1(tx);
             }
           };
 
-          for (Index_type ty = 0; ty < TL_SZ; ++ty) {
-            if (ty < TL_SZ)
+          for (Index_type ty = 0; ty < tile_size; ++ty) {
+            if (ty < tile_size)
               inner_y_1(ty);
           }
 
-          for (Index_type k = 0; k < (TL_SZ + N - 1) / TL_SZ; ++k) {
+          for (Index_type k = 0; k < (tile_size + N - 1) / tile_size; ++k) {
 
             auto inner_y_2 = [&](Index_type ty) {
-              auto inner_x_2 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_2(TL_SZ) };
+              auto inner_x_2 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_2(tile_size) };
 
-              for (Index_type tx = 0; tx < TL_SZ; ++tx) {
+              for (Index_type tx = 0; tx < tile_size; ++tx) {
                 inner_x_2(tx);
               }
             };
 
-            for (Index_type ty = 0; ty < TL_SZ; ++ty) {
+            for (Index_type ty = 0; ty < tile_size; ++ty) {
               inner_y_2(ty);
             }
 
             auto inner_y_3 = [&](Index_type ty) {
-              auto inner_x_3 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_3(TL_SZ) };
+              auto inner_x_3 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_3(tile_size) };
 
-              for (Index_type tx = 0; tx < TL_SZ; ++tx) {
+              for (Index_type tx = 0; tx < tile_size; ++tx) {
                 inner_x_3(tx);
               }
             };
 
-            for (Index_type ty = 0; ty < TL_SZ; ++ty) {
+            for (Index_type ty = 0; ty < tile_size; ++ty) {
               inner_y_3(ty);
             }
           }
 
           auto inner_y_4 = [&](Index_type ty) {
-            auto inner_x_4 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_4(TL_SZ) };
+            auto inner_x_4 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_4(tile_size) };
 
-            for (Index_type tx = 0; tx < TL_SZ; ++tx) {
+            for (Index_type tx = 0; tx < tile_size; ++tx) {
               inner_x_4(tx);
             }
           };
 
-          for (Index_type ty = 0; ty < TL_SZ; ++ty) {
+          for (Index_type ty = 0; ty < tile_size; ++ty) {
             inner_y_4(ty);
           }
         }; // outer_x
@@ -181,25 +184,25 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
               RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, Nx),
                 [&](Index_type bx) {
 
-                  MAT_MAT_SHARED_BODY_0(TL_SZ)
+                  MAT_MAT_SHARED_BODY_0(tile_size)
 
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, tile_size),
                     [&](Index_type ty) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, tile_size),
                         [&](Index_type tx) {
-                          MAT_MAT_SHARED_BODY_1(TL_SZ)
+                          MAT_MAT_SHARED_BODY_1(tile_size)
                         }
                       );  // RAJA::expt::loop<inner_x>
                     }
                   );  // RAJA::expt::loop<inner_y
 
-                  for (Index_type k = 0; k < (TL_SZ + N - 1) / TL_SZ; k++) {
+                  for (Index_type k = 0; k < (tile_size + N - 1) / tile_size; k++) {
 
-                    RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                    RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, tile_size),
                       [&](Index_type ty) {
-                        RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                        RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, tile_size),
                           [&](Index_type tx) {
-                            MAT_MAT_SHARED_BODY_2(TL_SZ)
+                            MAT_MAT_SHARED_BODY_2(tile_size)
                           }
                         );  // RAJA::expt::loop<inner_x>
                       }
@@ -207,11 +210,11 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
                     ctx.teamSync();
 
-                    RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                    RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, tile_size),
                       [&](Index_type ty) {
-                        RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                        RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, tile_size),
                           [&](Index_type tx) {
-                            MAT_MAT_SHARED_BODY_3(TL_SZ)
+                            MAT_MAT_SHARED_BODY_3(tile_size)
                           }
                         );  // RAJA::expt::loop<inner_x>
                       }
@@ -221,11 +224,11 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
                   }  // for (k)
 
-                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                  RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, tile_size),
                     [&](Index_type ty) {
-                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, TL_SZ),
+                      RAJA::expt::loop<inner_x>(ctx, RAJA::RangeSegment(0, tile_size),
                         [&](Index_type tx) {
-                          MAT_MAT_SHARED_BODY_4(TL_SZ)
+                          MAT_MAT_SHARED_BODY_4(tile_size)
                         }
                       );  // RAJA::expt::loop<inner_x>
                     }
@@ -256,5 +259,24 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( !host_tuning::run_tuning<host_tuning::tile_size, host_tile_sizes_type>(
+         tuning_name,
+         [&](auto tile_size) { runOpenMPVariantImpl<tile_size>(vid); }) ) {
+    runOpenMPVariantImpl<TL_SZ>(vid);
+  }
+}
+
+void MAT_MAT_SHARED::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantHostTuningNames<host_tuning::tile_size, host_tile_sizes_type>(vid);
+  setTileSizeFLOPsPerRep(vid);
+}
+
 } // end namespace basic
 } // end namespace rajaperf
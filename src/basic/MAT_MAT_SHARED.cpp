@@ -34,9 +34,7 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
   setBytesPerRep( m_N*m_N*sizeof(Real_type) +
                   m_N*m_N*sizeof(Real_type) );
 
-  const Index_type no_tiles = (TL_SZ + m_N - 1) / TL_SZ;
-  const Index_type no_blocks = RAJA_DIVIDE_CEILING_INT(m_N, TL_SZ);
-  setFLOPsPerRep(2 * TL_SZ * TL_SZ * TL_SZ * no_tiles * no_blocks * no_blocks);
+  setFLOPsPerRep(getTiledFLOPsPerRep(TL_SZ));
 
   checksum_scale_factor = 1e-6 *
               ( static_cast<Checksum_type>(getDefaultProblemSize()) /
@@ -64,6 +62,28 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
 
 MAT_MAT_SHARED::~MAT_MAT_SHARED() {}
 
+//
+// Every tile multiplies the zero padded tiles of A and B, so the FLOPs
+// depend on the tile size.
+//
+Index_type MAT_MAT_SHARED::getTiledFLOPsPerRep(Index_type tile_size) const
+{
+  const Index_type no_tiles = (tile_size + m_N - 1) / tile_size;
+  const Index_type no_blocks = RAJA_DIVIDE_CEILING_INT(m_N, tile_size);
+  return 2 * tile_size * tile_size * tile_size * no_tiles * no_blocks * no_blocks;
+}
+
+void MAT_MAT_SHARED::setTileSizeFLOPsPerRep(VariantID vid)
+{
+  seq_for(host_tile_sizes_type{}, [&](auto tile_size) {
+    const std::string name =
+        host_tuning::tuning_name<host_tuning::tile_size>(tile_size);
+    if ( hasVariantTuningDefined(vid, name) ) {
+      setVariantTuningFLOPsPerRep(vid, name, getTiledFLOPsPerRep(tile_size));
+    }
+  });
+}
+
 void MAT_MAT_SHARED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
   const Index_type NN = m_N * m_N;
 
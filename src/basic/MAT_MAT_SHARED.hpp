@@ -61,6 +61,9 @@
 ///        }
 ///      }
 ///
+/// The default tuning of the host variants uses TL_SZ x TL_SZ tiles, the
+/// "tile_<N>" tunings use N x N tiles. The FLOPs of each tuning include the
+/// multiplies of the zero padding of its partial tiles.
 ///
 
 #ifndef RAJAPerf_Basic_MAT_MAT_SHARED_HPP
@@ -140,8 +143,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantImpl(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -150,6 +159,11 @@ public:
 private:
   static const size_t default_gpu_block_size = TL_SZ * TL_SZ;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size, gpu_block_size::ExactSqrt>;
+  using host_tile_sizes_type = host_tuning::make_list_type<host_tuning::tile_size,
+                                                           host_tuning::list_type<8, 32>>;
+
+  Index_type getTiledFLOPsPerRep(Index_type tile_size) const;
+  void setTileSizeFLOPsPerRep(VariantID vid);
 
   Real_ptr m_A;
   Real_ptr m_B;
@@ -31,6 +31,28 @@
   out2[i] = in1[i] + in2[i] ; \
   out3[i] = in1[i] - in2[i] ;
 
+#define MULADDSUB_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* out1; \
+  StorageT* out2; \
+  StorageT* out3; \
+  StorageT* in1; \
+  StorageT* in2; \
+  allocAndInitStorageData(out1, m_out1, iend, vid); \
+  allocAndInitStorageData(out2, m_out2, iend, vid); \
+  allocAndInitStorageData(out3, m_out3, iend, vid); \
+  allocAndInitStorageData(in1, m_in1, iend, vid); \
+  allocAndInitStorageData(in2, m_in2, iend, vid);
+
+#define MULADDSUB_DATA_TEARDOWN_STORAGE \
+  getStorageData(m_out1, out1, iend); \
+  getStorageData(m_out2, out2, iend); \
+  getStorageData(m_out3, out3, iend); \
+  deallocStorageData(out1); \
+  deallocStorageData(out2); \
+  deallocStorageData(out3); \
+  deallocStorageData(in1); \
+  deallocStorageData(in2);
+
 
 #include "common/KernelBase.hpp"
 
@@ -59,8 +81,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -70,6 +98,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_out1;
   Real_ptr m_out2;
   Real_ptr m_out3;
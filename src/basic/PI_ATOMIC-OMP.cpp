@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/DataUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,10 +20,23 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  switch ( tune_idx ) {
+    case 0 : break;
+    case 1 : runOpenMPVariantSlots(vid, 1, 1); return;
+    case 2 : runOpenMPVariantSlots(vid, cacheline_reals, 1); return;
+    case 3 : runOpenMPVariantSlots(vid, cacheline_reals, cacheline_reals); return;
+    case 4 : runOpenMPVariantLocal(vid, false); return;
+    case 5 : runOpenMPVariantLocal(vid, true); return;
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown OpenMP tuning index = " << tune_idx << std::endl;
+      return;
+    }
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -101,8 +116,244 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+//
+// Atomic adds into slot_stride separated slots, threads_per_slot
+// consecutive threads share a slot.
+//
+void PI_ATOMIC::runOpenMPVariantSlots(VariantID vid,
+                                      Index_type slot_stride,
+                                      Index_type threads_per_slot)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+
+  const Index_type nthreads = omp_get_max_threads();
+  const Index_type nslots = (nthreads + threads_per_slot - 1) / threads_per_slot;
+
+  Real_ptr slots;
+  allocAndInitDataConst(slots, nslots * slot_stride, 0.0, vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (Index_type s = 0; s < nslots; ++s) {
+          slots[s * slot_stride] = 0.0;
+        }
+
+        #pragma omp parallel
+        {
+          Real_ptr slot = slots +
+              (omp_get_thread_num() / threads_per_slot) * slot_stride;
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            #pragma omp atomic
+            *slot += dx / (1.0 + x * x);
+          }
+        }
+
+        for (Index_type s = 0; s < nslots; ++s) {
+          *pi += slots[s * slot_stride];
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (Index_type s = 0; s < nslots; ++s) {
+          slots[s * slot_stride] = 0.0;
+        }
+
+        #pragma omp parallel
+        {
+          Real_ptr slot = slots +
+              (omp_get_thread_num() / threads_per_slot) * slot_stride;
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              double x = (double(i) + 0.5) * dx;
+              RAJA::atomicAdd<RAJA::omp_atomic>(slot, dx / (1.0 + x * x));
+          });
+        }
+
+        for (Index_type s = 0; s < nslots; ++s) {
+          *pi += slots[s * slot_stride];
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(slots);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(slot_stride);
+  RAJA_UNUSED_VAR(threads_per_slot);
+#endif
+}
+
+//
+// Thread local sums added with one atomic per thread, either directly
+// into pi or into one cache line padded slot per cache line of threads.
+//
+void PI_ATOMIC::runOpenMPVariantLocal(VariantID vid, bool hierarchical)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+
+  const Index_type nthreads = omp_get_max_threads();
+  const Index_type nslots = (nthreads + cacheline_reals - 1) / cacheline_reals;
+  const Index_type slot_stride = cacheline_reals;
+
+  Real_ptr slots;
+  allocAndInitDataConst(slots, nslots * slot_stride, 0.0, vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (Index_type s = 0; s < nslots; ++s) {
+          slots[s * slot_stride] = 0.0;
+        }
+
+        #pragma omp parallel
+        {
+          Real_ptr slot = hierarchical
+              ? slots + (omp_get_thread_num() / cacheline_reals) * slot_stride
+              : pi;
+
+          Real_type local_pi = 0.0;
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            local_pi += dx / (1.0 + x * x);
+          }
+
+          #pragma omp atomic
+          *slot += local_pi;
+        }
+
+        if (hierarchical) {
+          for (Index_type s = 0; s < nslots; ++s) {
+            *pi += slots[s * slot_stride];
+          }
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (Index_type s = 0; s < nslots; ++s) {
+          slots[s * slot_stride] = 0.0;
+        }
+
+        #pragma omp parallel
+        {
+          Real_ptr slot = hierarchical
+              ? slots + (omp_get_thread_num() / cacheline_reals) * slot_stride
+              : pi;
+
+          Real_type local_pi = 0.0;
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [&](Index_type i) {
+              double x = (double(i) + 0.5) * dx;
+              local_pi += dx / (1.0 + x * x);
+          });
+
+          RAJA::atomicAdd<RAJA::omp_atomic>(slot, local_pi);
+        }
+
+        if (hierarchical) {
+          for (Index_type s = 0; s < nslots; ++s) {
+            *pi += slots[s * slot_stride];
+          }
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(slots);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(hierarchical);
+#endif
+}
+
+void PI_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "per_thread");
+    addVariantTuningName(vid, "per_thread_padded");
+    addVariantTuningName(vid, "per_cacheline");
+    addVariantTuningName(vid, "thread_local");
+    addVariantTuningName(vid, "hierarchical");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
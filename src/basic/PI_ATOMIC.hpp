@@ -19,6 +19,19 @@
 /// }
 /// pi *= 4.0;
 ///
+/// The Base and RAJA OpenMP variants have tunings that vary the atomic
+/// contention, the partial sums are added into pi after the loop:
+///
+///  "per_thread"        each thread adds into its own slot, the slots are
+///                      contiguous so threads share cache lines
+///  "per_thread_padded" each thread adds into its own cache line
+///  "per_cacheline"     the threads sharing a cache line in "per_thread"
+///                      add into one slot, one slot per cache line
+///  "thread_local"      each thread sums into a local and adds it into pi
+///                      with one atomic
+///  "hierarchical"      each thread sums into a local and adds it into its
+///                      "per_cacheline" slot with one atomic
+///
 
 #ifndef RAJAPerf_Basic_PI_ATOMIC_HPP
 #define RAJAPerf_Basic_PI_ATOMIC_HPP
@@ -55,8 +68,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantSlots(VariantID vid, Index_type slot_stride,
+                             Index_type threads_per_slot);
+  void runOpenMPVariantLocal(VariantID vid, bool hierarchical);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -66,6 +83,9 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // number of Real_type values in an aligned cache line
+  static const Index_type cacheline_reals = RAJA::DATA_ALIGN / sizeof(Real_type);
+
   Real_type m_dx;
   Real_ptr m_pi;
   Real_type m_pi_init;
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <limits>
+#include <utility>
 #include <iostream>
 
 namespace rajaperf
@@ -19,10 +20,42 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+    if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+      if ( tune_idx == t ) {
+        runOpenMPVariantPacked(vid);
+        return;
+      }
+      t += 1;
+    }
+
+#if defined(RAJA_EXPT_FORALL)
+    if ( vid == RAJA_OpenMP ) {
+      if ( tune_idx == t ) {
+        runOpenMPVariantExptReduce(vid);
+        return;
+      }
+      t += 1;
+    }
+#endif
+
+    seq_for(reducer_counts_type{}, [&](auto num_reducers) {
+      if ( tune_idx == t ) {
+        runOpenMPVariantReducers<num_reducers>(vid);
+      }
+      t += 1;
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -119,10 +152,319 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+//
+// Each thread reduces into locals and stores all three results into its own
+// cache line, the cache lines are combined once after the loop.
+//
+void REDUCE3_INT::runOpenMPVariantPacked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  const Index_type nthreads = omp_get_max_threads();
+  const Index_type slot_stride = cacheline_ints;
+
+  Int_ptr slots =
+    RAJA::allocate_aligned_type<Int_type>(RAJA::DATA_ALIGN,
+                                          nthreads*slot_stride*sizeof(Int_type));
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nthreads; ++s) {
+          slots[s * slot_stride + 0] = 0;
+          slots[s * slot_stride + 1] = m_vmin_init;
+          slots[s * slot_stride + 2] = m_vmax_init;
+        }
+
+        #pragma omp parallel
+        {
+          Int_type vsum = 0;
+          Int_type vmin = m_vmin_init;
+          Int_type vmax = m_vmax_init;
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
+
+          Int_ptr slot = slots + omp_get_thread_num() * slot_stride;
+          slot[0] = vsum;
+          slot[1] = vmin;
+          slot[2] = vmax;
+        }
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+        for (Index_type s = 0; s < nthreads; ++s) {
+          vsum += slots[s * slot_stride + 0];
+          vmin = RAJA_MIN(vmin, slots[s * slot_stride + 1]);
+          vmax = RAJA_MAX(vmax, slots[s * slot_stride + 2]);
+        }
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nthreads; ++s) {
+          slots[s * slot_stride + 0] = 0;
+          slots[s * slot_stride + 1] = m_vmin_init;
+          slots[s * slot_stride + 2] = m_vmax_init;
+        }
+
+        #pragma omp parallel
+        {
+          Int_type vsum = 0;
+          Int_type vmin = m_vmin_init;
+          Int_type vmax = m_vmax_init;
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [&](Index_type i) {
+            REDUCE3_INT_BODY;
+          });
+
+          Int_ptr slot = slots + omp_get_thread_num() * slot_stride;
+          slot[0] = vsum;
+          slot[1] = vmin;
+          slot[2] = vmax;
+        }
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+        for (Index_type s = 0; s < nthreads; ++s) {
+          vsum += slots[s * slot_stride + 0];
+          vmin = RAJA_MIN(vmin, slots[s * slot_stride + 1]);
+          vmax = RAJA_MAX(vmax, slots[s * slot_stride + 2]);
+        }
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  RAJA::free_aligned(slots);
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+//
+// RAJA::expt::Reduce forall parameters in place of reducer objects.
+//
+void REDUCE3_INT::runOpenMPVariantExptReduce(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && defined(RAJA_EXPT_FORALL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&vsum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&vmin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&vmax),
+          [=](Index_type i, Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+            REDUCE3_INT_BODY;
+        });
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// num_reducers copies of each reduction, see runSeqVariantReducers.
+//
+template < size_t num_reducers >
+void REDUCE3_INT::runOpenMPVariantReducers(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum[num_reducers];
+        Int_type vmin[num_reducers];
+        Int_type vmax[num_reducers];
+        for (size_t r = 0; r < num_reducers; ++r) { vsum[r] = m_vsum_init; }
+        for (size_t r = 0; r < num_reducers; ++r) { vmin[r] = m_vmin_init; }
+        for (size_t r = 0; r < num_reducers; ++r) { vmax[r] = m_vmax_init; }
+
+        #pragma omp parallel for reduction(+:vsum[:num_reducers]), \
+                                 reduction(min:vmin[:num_reducers]), \
+                                 reduction(max:vmax[:num_reducers])
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vsum[r] += vec[i];
+          }
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vmin[r] = RAJA_MIN(vmin[r], vec[i]);
+          }
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vmax[r] = RAJA_MAX(vmax[r], vec[i]);
+          }
+        }
+
+        Int_type sum = vsum[0];
+        for (size_t r = 1; r < num_reducers; ++r) { sum = RAJA_MIN(sum, vsum[r]); }
+        m_vsum += sum;
+        for (size_t r = 0; r < num_reducers; ++r) { m_vmin = RAJA_MIN(m_vmin, vmin[r]); }
+        for (size_t r = 0; r < num_reducers; ++r) { m_vmax = RAJA_MAX(m_vmax, vmax[r]); }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        auto vsum = makeReducers<RAJA::ReduceSum<RAJA::omp_reduce, Int_type>>(
+                      m_vsum_init, std::make_index_sequence<num_reducers>{});
+        auto vmin = makeReducers<RAJA::ReduceMin<RAJA::omp_reduce, Int_type>>(
+                      m_vmin_init, std::make_index_sequence<num_reducers>{});
+        auto vmax = makeReducers<RAJA::ReduceMax<RAJA::omp_reduce, Int_type>>(
+                      m_vmax_init, std::make_index_sequence<num_reducers>{});
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          for (auto const& s : vsum) { s += vec[i]; }
+          for (auto const& s : vmin) { s.min(vec[i]); }
+          for (auto const& s : vmax) { s.max(vec[i]); }
+        });
+
+        Int_type sum = static_cast<Int_type>(vsum[0].get());
+        for (size_t r = 1; r < num_reducers; ++r) {
+          sum = RAJA_MIN(sum, static_cast<Int_type>(vsum[r].get()));
+        }
+        m_vsum += sum;
+        for (size_t r = 0; r < num_reducers; ++r) {
+          m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(vmin[r].get()));
+        }
+        for (size_t r = 0; r < num_reducers; ++r) {
+          m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(vmax[r].get()));
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE3_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "packed");
+  }
+
+#if defined(RAJA_EXPT_FORALL)
+  if ( vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "expt_reduce");
+  }
+#endif
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    seq_for(reducer_counts_type{}, [&](auto num_reducers) {
+      addVariantTuningName(vid, "reducers_"+std::to_string(num_reducers));
+    });
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
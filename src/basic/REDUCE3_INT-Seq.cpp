@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <limits>
+#include <utility>
 #include <iostream>
 
 namespace rajaperf
@@ -19,8 +20,32 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE3_INT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx > 0 ) {
+
+    size_t t = 1;
+
+#if defined(RUN_RAJA_SEQ) && defined(RAJA_EXPT_FORALL)
+    if ( vid == RAJA_Seq ) {
+      if ( tune_idx == t ) {
+        runSeqVariantExptReduce(vid);
+        return;
+      }
+      t += 1;
+    }
+#endif
+
+    seq_for(reducer_counts_type{}, [&](auto num_reducers) {
+      if ( tune_idx == t ) {
+        runSeqVariantReducers<num_reducers>(vid);
+      }
+      t += 1;
+    });
+
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -115,5 +140,176 @@ void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+//
+// RAJA::expt::Reduce forall parameters in place of reducer objects.
+//
+void REDUCE3_INT::runSeqVariantExptReduce(VariantID vid)
+{
+#if defined(RUN_RAJA_SEQ) && defined(RAJA_EXPT_FORALL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum = m_vsum_init;
+        Int_type vmin = m_vmin_init;
+        Int_type vmax = m_vmax_init;
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&vsum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&vmin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&vmax),
+          [=](Index_type i, Int_type& vsum, Int_type& vmin, Int_type& vmax) {
+            REDUCE3_INT_BODY;
+        });
+
+        m_vsum += vsum;
+        m_vmin = RAJA_MIN(m_vmin, vmin);
+        m_vmax = RAJA_MAX(m_vmax, vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// num_reducers copies of each of the sum, min, and max reductions, so
+// reducers_1 does the same work as the default tuning. The redundant results
+// are equal, they are combined with min and max so none of them can be
+// optimized away.
+//
+template < size_t num_reducers >
+void REDUCE3_INT::runSeqVariantReducers(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Int_type vsum[num_reducers];
+        Int_type vmin[num_reducers];
+        Int_type vmax[num_reducers];
+        for (size_t r = 0; r < num_reducers; ++r) { vsum[r] = m_vsum_init; }
+        for (size_t r = 0; r < num_reducers; ++r) { vmin[r] = m_vmin_init; }
+        for (size_t r = 0; r < num_reducers; ++r) { vmax[r] = m_vmax_init; }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vsum[r] += vec[i];
+          }
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vmin[r] = RAJA_MIN(vmin[r], vec[i]);
+          }
+          for (size_t r = 0; r < num_reducers; ++r) {
+            vmax[r] = RAJA_MAX(vmax[r], vec[i]);
+          }
+        }
+
+        Int_type sum = vsum[0];
+        for (size_t r = 1; r < num_reducers; ++r) { sum = RAJA_MIN(sum, vsum[r]); }
+        m_vsum += sum;
+        for (size_t r = 0; r < num_reducers; ++r) { m_vmin = RAJA_MIN(m_vmin, vmin[r]); }
+        for (size_t r = 0; r < num_reducers; ++r) { m_vmax = RAJA_MAX(m_vmax, vmax[r]); }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        auto vsum = makeReducers<RAJA::ReduceSum<RAJA::seq_reduce, Int_type>>(
+                      m_vsum_init, std::make_index_sequence<num_reducers>{});
+        auto vmin = makeReducers<RAJA::ReduceMin<RAJA::seq_reduce, Int_type>>(
+                      m_vmin_init, std::make_index_sequence<num_reducers>{});
+        auto vmax = makeReducers<RAJA::ReduceMax<RAJA::seq_reduce, Int_type>>(
+                      m_vmax_init, std::make_index_sequence<num_reducers>{});
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          for (auto const& s : vsum) { s += vec[i]; }
+          for (auto const& s : vmin) { s.min(vec[i]); }
+          for (auto const& s : vmax) { s.max(vec[i]); }
+        });
+
+        Int_type sum = static_cast<Int_type>(vsum[0].get());
+        for (size_t r = 1; r < num_reducers; ++r) {
+          sum = RAJA_MIN(sum, static_cast<Int_type>(vsum[r].get()));
+        }
+        m_vsum += sum;
+        for (size_t r = 0; r < num_reducers; ++r) {
+          m_vmin = RAJA_MIN(m_vmin, static_cast<Int_type>(vmin[r].get()));
+        }
+        for (size_t r = 0; r < num_reducers; ++r) {
+          m_vmax = RAJA_MAX(m_vmax, static_cast<Int_type>(vmax[r].get()));
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void REDUCE3_INT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_EXPT_FORALL)
+  if ( vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "expt_reduce");
+  }
+#endif
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    seq_for(reducer_counts_type{}, [&](auto num_reducers) {
+      addVariantTuningName(vid, "reducers_"+std::to_string(num_reducers));
+    });
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
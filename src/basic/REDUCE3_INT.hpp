@@ -25,6 +25,18 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// Tunings that measure the cost of the reducers themselves:
+///
+///  "packed"        (Base/RAJA OpenMP) each thread reduces into locals and
+///                  stores all three results into its own cache line, the
+///                  cache lines are combined once after the loop
+///  "expt_reduce"   (RAJA Seq/OpenMP) uses the RAJA::expt::Reduce forall
+///                  parameter interface instead of reducer objects, only
+///                  when RAJA is built with RAJA_EXPT_FORALL
+///  "reducers_<N>"  (Base/RAJA Seq/OpenMP) N copies of each of the sum, min
+///                  and max reductions, the redundant results are combined
+///                  after the loop, reducers_1 is the baseline of the sweep
+///
 
 #ifndef RAJAPerf_Basic_REDUCE3_INT_HPP
 #define RAJAPerf_Basic_REDUCE3_INT_HPP
@@ -46,6 +58,9 @@
 
 #include "common/KernelBase.hpp"
 
+#include <array>
+#include <utility>
+
 namespace rajaperf
 {
 class RunParams;
@@ -53,6 +68,16 @@ class RunParams;
 namespace basic
 {
 
+//
+// Array of sizeof...(Is) reducers with initial value init. The array is
+// captured by copy in the kernel lambdas without a heap allocation.
+//
+template < typename Reducer, typename T, size_t... Is >
+std::array<Reducer, sizeof...(Is)> makeReducers(T init, std::index_sequence<Is...>)
+{
+  return {{ (static_cast<void>(Is), Reducer(init))... }};
+}
+
 class REDUCE3_INT : public KernelBase
 {
 public:
@@ -71,8 +96,17 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runSeqVariantExptReduce(VariantID vid);
+  void runOpenMPVariantExptReduce(VariantID vid);
+  template < size_t num_reducers >
+  void runSeqVariantReducers(VariantID vid);
+  template < size_t num_reducers >
+  void runOpenMPVariantReducers(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -82,6 +116,10 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  static const Index_type cacheline_ints = RAJA::DATA_ALIGN / sizeof(Int_type);
+
+  using reducer_counts_type = camp::int_seq<size_t, 1, 2, 4, 8, 16>;
+
   Int_ptr m_vec;
   Int_type m_vsum;
   Int_type m_vsum_init;
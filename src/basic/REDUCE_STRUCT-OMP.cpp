@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/DataUtils.hpp"
+
 #include <limits>
 #include <iostream>
 
@@ -19,10 +21,22 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+
+    runOpenMPVariantPacked(vid);
+    return;
+
+  } else if ( tune_idx == 2 ) {
+
+    runOpenMPVariantExptReduce(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -147,6 +161,225 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else 
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+//
+// Each thread reduces into locals and stores all six results into its own
+// cache line, the cache lines are combined once after the loop.
+//
+void REDUCE_STRUCT::runOpenMPVariantPacked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  const Index_type nthreads = omp_get_max_threads();
+  const Index_type slot_stride =
+      (6 + cacheline_reals - 1) / cacheline_reals * cacheline_reals;
+
+  Real_ptr slots;
+  allocAndInitDataConst(slots, nthreads * slot_stride, 0.0, vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nthreads; ++s) {
+          Real_ptr slot = slots + s * slot_stride;
+          slot[0] = 0.0; slot[1] = m_init_min; slot[2] = m_init_max;
+          slot[3] = 0.0; slot[4] = m_init_min; slot[5] = m_init_max;
+        }
+
+        #pragma omp parallel
+        {
+          Real_type xsum = 0.0;        Real_type ysum = 0.0;
+          Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+          Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+
+          #pragma omp for nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE_STRUCT_BODY;
+          }
+
+          Real_ptr slot = slots + omp_get_thread_num() * slot_stride;
+          slot[0] = xsum; slot[1] = xmin; slot[2] = xmax;
+          slot[3] = ysum; slot[4] = ymin; slot[5] = ymax;
+        }
+
+        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
+        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+        for (Index_type s = 0; s < nthreads; ++s) {
+          Real_ptr slot = slots + s * slot_stride;
+          xsum += slot[0];
+          xmin = RAJA_MIN(xmin, slot[1]);
+          xmax = RAJA_MAX(xmax, slot[2]);
+          ysum += slot[3];
+          ymin = RAJA_MIN(ymin, slot[4]);
+          ymax = RAJA_MAX(ymax, slot[5]);
+        }
+
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(xmin);
+        points.SetXMax(xmax);
+        points.SetYMin(ymin);
+        points.SetYMax(ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nthreads; ++s) {
+          Real_ptr slot = slots + s * slot_stride;
+          slot[0] = 0.0; slot[1] = m_init_min; slot[2] = m_init_max;
+          slot[3] = 0.0; slot[4] = m_init_min; slot[5] = m_init_max;
+        }
+
+        #pragma omp parallel
+        {
+          Real_type xsum = 0.0;        Real_type ysum = 0.0;
+          Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+          Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), [&](Index_type i) {
+            REDUCE_STRUCT_BODY;
+          });
+
+          Real_ptr slot = slots + omp_get_thread_num() * slot_stride;
+          slot[0] = xsum; slot[1] = xmin; slot[2] = xmax;
+          slot[3] = ysum; slot[4] = ymin; slot[5] = ymax;
+        }
+
+        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
+        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+        for (Index_type s = 0; s < nthreads; ++s) {
+          Real_ptr slot = slots + s * slot_stride;
+          xsum += slot[0];
+          xmin = RAJA_MIN(xmin, slot[1]);
+          xmax = RAJA_MAX(xmax, slot[2]);
+          ysum += slot[3];
+          ymin = RAJA_MIN(ymin, slot[4]);
+          ymax = RAJA_MAX(ymax, slot[5]);
+        }
+
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(xmin);
+        points.SetXMax(xmax);
+        points.SetYMin(ymin);
+        points.SetYMax(ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(slots);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// RAJA::expt::Reduce forall parameters in place of reducer objects.
+//
+void REDUCE_STRUCT::runOpenMPVariantExptReduce(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && defined(RAJA_EXPT_FORALL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
+        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&xsum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&xmin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&xmax),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&ysum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&ymin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&ymax),
+          [=](Index_type i, Real_type& xsum, Real_type& xmin, Real_type& xmax,
+                            Real_type& ysum, Real_type& ymin, Real_type& ymax) {
+            REDUCE_STRUCT_BODY;
+        });
+
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(xmin);
+        points.SetXMax(xmax);
+        points.SetYMin(ymin);
+        points.SetYMax(ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_STRUCT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "packed");
+  }
+
+#if defined(RAJA_EXPT_FORALL)
+  if ( vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "expt_reduce");
+  }
 #endif
 }
 
@@ -19,8 +19,15 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+
+    runSeqVariantExptReduce(vid);
+    return;
+
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -135,5 +142,77 @@ void REDUCE_STRUCT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+//
+// RAJA::expt::Reduce forall parameters in place of reducer objects.
+//
+void REDUCE_STRUCT::runSeqVariantExptReduce(VariantID vid)
+{
+#if defined(RUN_RAJA_SEQ) && defined(RAJA_EXPT_FORALL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
+        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&xsum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&xmin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&xmax),
+          RAJA::expt::Reduce<RAJA::operators::plus>(&ysum),
+          RAJA::expt::Reduce<RAJA::operators::minimum>(&ymin),
+          RAJA::expt::Reduce<RAJA::operators::maximum>(&ymax),
+          [=](Index_type i, Real_type& xsum, Real_type& xmin, Real_type& xmax,
+                            Real_type& ysum, Real_type& ymin, Real_type& ymax) {
+            REDUCE_STRUCT_BODY;
+        });
+
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(xmin);
+        points.SetXMax(xmax);
+        points.SetYMin(ymin);
+        points.SetYMax(ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_STRUCT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RAJA_EXPT_FORALL)
+  if ( vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "expt_reduce");
+  }
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
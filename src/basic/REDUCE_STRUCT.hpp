@@ -32,6 +32,15 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// Tunings that measure the cost of the reducers themselves:
+///
+///  "packed"        (Base/RAJA OpenMP) each thread reduces into locals and
+///                  stores all six results into its own cache line, the
+///                  cache lines are combined once after the loop
+///  "expt_reduce"   (RAJA Seq/OpenMP) uses the RAJA::expt::Reduce forall
+///                  parameter interface instead of reducer objects, only
+///                  when RAJA is built with RAJA_EXPT_FORALL
+///
 
 #ifndef RAJAPerf_Basic_REDUCE_STRUCT_HPP
 #define RAJAPerf_Basic_REDUCE_STRUCT_HPP
@@ -87,8 +96,13 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runSeqVariantExptReduce(VariantID vid);
+  void runOpenMPVariantExptReduce(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -118,6 +132,9 @@ public:
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  static const Index_type cacheline_reals = RAJA::DATA_ALIGN / sizeof(Real_type);
+
   Real_ptr m_x; Real_ptr m_y;
   Real_type	m_init_sum; 
   Real_type	m_init_min; 
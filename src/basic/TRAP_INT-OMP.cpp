@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/FastMathUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -31,11 +33,42 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+#if defined(RP_USE_DOUBLE)
+//
+// Function used in TRAP_INT loop of the rsqrt tunings.
+//
+template < int newton_iters >
+RAJA_INLINE
+Real_type trap_int_func_rsqrt(Real_type x,
+                              Real_type y,
+                              Real_type xp,
+                              Real_type yp)
+{
+   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = rsqrtNewton<newton_iters>(denom);
+   return denom;
+}
+#endif
 
-void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+
+void TRAP_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+#if defined(RP_USE_DOUBLE)
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "rsqrt_newton2" ) {
+    runOpenMPVariantRsqrt<2>(vid);
+    return;
+  } else if ( tuning_name == "rsqrt_newton3" ) {
+    runOpenMPVariantRsqrt<3>(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -117,6 +150,88 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RP_USE_DOUBLE)
+template < int newton_iters >
+void TRAP_INT::runOpenMPVariantRsqrt(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRAP_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        #pragma omp parallel for reduction(+:sumx)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_RSQRT_BODY(newton_iters);
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sumx(m_sumx_init);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRAP_INT_RSQRT_BODY(newton_iters);
+        });
+
+        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRAP_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#endif // RP_USE_DOUBLE
+
+void TRAP_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RP_USE_DOUBLE)
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "rsqrt_newton2",
+                         getRsqrtNewtonChecksumTolerance<2>());
+    addVariantTuningName(vid, "rsqrt_newton3",
+                         getRsqrtNewtonChecksumTolerance<3>());
+  }
 #endif
 }
 
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/FastMathUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -31,9 +33,40 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+#if defined(RP_USE_DOUBLE)
+//
+// Function used in TRAP_INT loop of the rsqrt tunings.
+//
+template < int newton_iters >
+RAJA_INLINE
+Real_type trap_int_func_rsqrt(Real_type x,
+                              Real_type y,
+                              Real_type xp,
+                              Real_type yp)
+{
+   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = rsqrtNewton<newton_iters>(denom);
+   return denom;
+}
+#endif
+
 
-void TRAP_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRAP_INT::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+#if defined(RP_USE_DOUBLE)
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tuning_name == "rsqrt_newton2" ) {
+    runSeqVariantRsqrt<2>(vid);
+    return;
+  } else if ( tuning_name == "rsqrt_newton3" ) {
+    runSeqVariantRsqrt<3>(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -115,5 +148,82 @@ void TRAP_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+#if defined(RP_USE_DOUBLE)
+template < int newton_iters >
+void TRAP_INT::runSeqVariantRsqrt(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRAP_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_RSQRT_BODY(newton_iters);
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sumx(m_sumx_init);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRAP_INT_RSQRT_BODY(newton_iters);
+        });
+
+        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRAP_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#endif // RP_USE_DOUBLE
+
+void TRAP_INT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RP_USE_DOUBLE)
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "rsqrt_newton2",
+                         getRsqrtNewtonChecksumTolerance<2>());
+    addVariantTuningName(vid, "rsqrt_newton3",
+                         getRsqrtNewtonChecksumTolerance<3>());
+  }
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -24,6 +24,10 @@
 ///    sumx += trap_int_func(x, y, xp, yp);
 /// }
 ///
+/// The "rsqrt_newton2" and "rsqrt_newton3" tunings replace 1.0/sqrt with
+/// rsqrtNewton from common/FastMathUtils.hpp using 2 or 3 Newton
+/// iterations, they are only defined when Real_type is double.
+///
 
 #ifndef RAJAPerf_Basic_TRAP_INT_HPP
 #define RAJAPerf_Basic_TRAP_INT_HPP
@@ -40,6 +44,10 @@
   Real_type x = x0 + i*h; \
   sumx += trap_int_func(x, y, xp, yp);
 
+#define TRAP_INT_RSQRT_BODY(newton_iters) \
+  Real_type x = x0 + i*h; \
+  sumx += trap_int_func_rsqrt<newton_iters>(x, y, xp, yp);
+
 
 #include "common/KernelBase.hpp"
 
@@ -68,8 +76,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < int newton_iters >
+  void runSeqVariantRsqrt(VariantID vid);
+  template < int newton_iters >
+  void runOpenMPVariantRsqrt(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -11,7 +11,10 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
+#include <vector>
 
 namespace rajaperf
 {
@@ -72,6 +75,13 @@ void allocAndInitDataRandValue(Real_ptr& ptr, int len, VariantID vid)
   initDataRandValue(ptr, len, vid);
 }
 
+void allocAndInitDataDistribution(Real_ptr& ptr, int len,
+                                  InputDistributionID dist, VariantID vid)
+{
+  allocData(ptr, len);
+  initDataDistribution(ptr, len, dist, vid);
+}
+
 void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 {
   allocData(ptr, len);
@@ -97,8 +107,9 @@ void allocData(Real_ptr& ptr, int len)
 
 void allocData(Complex_ptr& ptr, int len)
 {
-  // Should we do this differently for alignment?? If so, change dealloc()
-  ptr = new Complex_type[len];
+  ptr =
+    RAJA::allocate_aligned_type<Complex_type>(RAJA::DATA_ALIGN,
+                                              len*sizeof(Complex_type));
 }
 
 
@@ -124,7 +135,7 @@ void deallocData(Real_ptr& ptr)
 void deallocData(Complex_ptr& ptr)
 {
   if (ptr) {
-    delete [] ptr;
+    RAJA::free_aligned(ptr);
     ptr = 0;
   }
 }
@@ -288,6 +299,77 @@ void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
   incDataInitCount();
 }
 
+/*
+ * Initialize Real_type data array with values from an input distribution.
+ */
+void initDataDistribution(Real_ptr& ptr, int len,
+                          InputDistributionID dist, VariantID vid)
+{
+  if ( dist == Dist_AllEqual ) {
+    initDataConst(ptr, len, 0.5, vid);
+    return;
+  }
+
+  initDataRandValue(ptr, len, vid);
+
+  switch ( dist ) {
+
+    case Dist_Sorted : {
+      std::sort(ptr, ptr+len);
+      break;
+    }
+
+    case Dist_Reverse : {
+      std::sort(ptr, ptr+len, std::greater<Real_type>());
+      break;
+    }
+
+    case Dist_NearlySorted : {
+      // sorted, then about one percent of the entries swapped in pairs
+      std::sort(ptr, ptr+len);
+      if ( len > 1 ) {
+        const int num_swaps = (len + 199) / 200;
+        for (int s = 0; s < num_swaps; ++s) {
+          int i = rand() % len;
+          int j = rand() % len;
+          std::swap(ptr[i], ptr[j]);
+        }
+      }
+      break;
+    }
+
+    case Dist_Duplicates : {
+      // 16 distinct values
+      const int num_values = 16;
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = Real_type(rand() % num_values) / num_values;
+      }
+      break;
+    }
+
+    case Dist_Zipf : {
+      // value rank/num_ranks with probability proportional to 1/rank
+      const int num_ranks = 1000;
+      std::vector<Real_type> cdf(num_ranks);
+      Real_type sum = 0.0;
+      for (int r = 0; r < num_ranks; ++r) {
+        sum += 1.0 / (r + 1);
+        cdf[r] = sum;
+      }
+      for (int i = 0; i < len; ++i) {
+        Real_type u = sum * (Real_type(rand())/RAND_MAX);
+        int r = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+        r = std::min(r, num_ranks-1);
+        ptr[i] = Real_type(r + 1) / num_ranks;
+      }
+      break;
+    }
+
+    default : { }
+
+  }
+}
+
 /*
  * Initialize Complex_type data array.
  */
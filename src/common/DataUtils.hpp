@@ -85,6 +85,17 @@ void allocAndInitDataRandSign(Real_ptr& ptr, int len,
 void allocAndInitDataRandValue(Real_ptr& ptr, int len,
                                VariantID vid = NumVariants);
 
+/*!
+ * \brief Allocate and initialize aligned Real_type data array with values
+ *        from the given input distribution.
+ *
+ * Array is initialized using method initDataDistribution(Real_ptr& ptr...)
+ * below.
+ */
+void allocAndInitDataDistribution(Real_ptr& ptr, int len,
+                                  InputDistributionID dist,
+                                  VariantID vid = NumVariants);
+
 /*!
  * \brief Allocate and initialize aligned Complex_type data array.
  */
@@ -155,6 +166,18 @@ void initDataRandSign(Real_ptr& ptr, int len,
 void initDataRandValue(Real_ptr& ptr, int len,
                        VariantID vid = NumVariants);
 
+/*!
+ * \brief Initialize Real_type data array with values from the given input
+ *        distribution.
+ *
+ * Array entries are in the interval [0.0, 1.0]. Dist_Uniform gives the same
+ * values as initDataRandValue(Real_ptr& ptr...) above, the other
+ * distributions are described with InputDistributionID.
+ */
+void initDataDistribution(Real_ptr& ptr, int len,
+                          InputDistributionID dist,
+                          VariantID vid = NumVariants);
+
 /*!
  * \brief Initialize Complex_type data array.
  *
@@ -27,6 +27,8 @@
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <limits>
+#include <numeric>
 
 #include <iostream>
 #include <iomanip>
@@ -98,6 +100,23 @@ void Allreduce(const Checksum_type* send, Checksum_type* recv, int count,
 
 #endif
 
+// Tuning searches with at most this many tunings try every tuning each pass,
+// larger searches use successive halving
+const size_t autotune_exhaustive_max_tunings = 4;
+
+// Name of the host the suite runs on, the name of rank 0 when using MPI so
+// every rank makes the same autotune choices
+std::string getRunHostName()
+{
+  char host[256] = "unknown";
+  gethostname(host, sizeof(host));
+  host[sizeof(host)-1] = '\0';
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Bcast(host, sizeof(host), MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+  return std::string(host);
+}
+
 }
 
 Executor::Executor(int argc, char** argv)
@@ -594,11 +613,7 @@ void Executor::setupSuite()
 
     for (KIDset::iterator kid = run_kern.begin();
          kid != run_kern.end(); ++kid) {
-///   RDH DISABLE COUPLE KERNEL until we find a reasonable way to do
-///   complex numbers in GPU code
-      if ( *kid != Apps_COUPLE ) {
-        kernels.push_back( getKernelObject(*kid, run_params) );
-      }
+      kernels.push_back( getKernelObject(*kid, run_params) );
     }
 
     if ( !(run_params.getInvalidVariantInput().empty()) ||
@@ -711,6 +726,13 @@ void Executor::reportRunSummary(ostream& str) const
       str << "\t Kernel size = " << run_params.getSize() << endl;
     }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    str << "\t Input distribution = "
+        << getInputDistributionName(run_params.getInputDistribution()) << endl;
+    if ( run_params.getAutotune() ) {
+      str << "\t Autotune best tunings "
+          << (run_params.getRetune() ? "(retune) " : "")
+          << "with cache file " << run_params.getAutotuneCacheFileName() << endl;
+    }
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants (when available for a kernel) will be run:" << endl;
@@ -744,6 +766,8 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
 #else
     str << "Kernels run without MPI" << endl;
 #endif
+    str << "Input distribution "
+        << getInputDistributionName(run_params.getInputDistribution()) << endl;
   }
 
 //
@@ -756,6 +780,7 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
   Index_type reps_width = 0;
   Index_type itsrep_width = 0;
   Index_type bytesrep_width = 0;
+  Index_type bytesWArep_width = 0;
   Index_type flopsrep_width = 0;
   Index_type dash_width = 0;
 
@@ -765,6 +790,7 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
     reps_width = max(reps_width, kernels[ik]->getRunReps());
     itsrep_width = max(reps_width, kernels[ik]->getItsPerRep());
     bytesrep_width = max(bytesrep_width, kernels[ik]->getBytesPerRep());
+    bytesWArep_width = max(bytesWArep_width, kernels[ik]->getBytesWriteAllocatePerRep());
     flopsrep_width = max(bytesrep_width, kernels[ik]->getFLOPsPerRep());
   }
 
@@ -803,6 +829,12 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
                         static_cast<Index_type>(brsize) ) + 3;
   dash_width += bytesrep_width + static_cast<Index_type>(sepchr.size());
 
+  double bwarsize = log10( static_cast<double>(max(bytesWArep_width, static_cast<Index_type>(1))) );
+  string bytesWArep_head("Write-allocate bytes/rep");
+  bytesWArep_width = max( static_cast<Index_type>(bytesWArep_head.size()),
+                          static_cast<Index_type>(bwarsize) ) + 3;
+  dash_width += bytesWArep_width + static_cast<Index_type>(sepchr.size());
+
   double frsize = log10( static_cast<double>(flopsrep_width) );
   string flopsrep_head("FLOPS/rep");
   flopsrep_width = max( static_cast<Index_type>(flopsrep_head.size()),
@@ -815,6 +847,7 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
       << sepchr <<right<< setw(itsrep_width) << itsrep_head
       << sepchr <<right<< setw(kernsrep_width) << kernsrep_head
       << sepchr <<right<< setw(bytesrep_width) << bytesrep_head
+      << sepchr <<right<< setw(bytesWArep_width) << bytesWArep_head
       << sepchr <<right<< setw(flopsrep_width) << flopsrep_head
       << endl;
 
@@ -833,6 +866,7 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
         << sepchr <<right<< setw(itsrep_width) << kern->getItsPerRep()
         << sepchr <<right<< setw(kernsrep_width) << kern->getKernelsPerRep()
         << sepchr <<right<< setw(bytesrep_width) << kern->getBytesPerRep()
+        << sepchr <<right<< setw(bytesWArep_width) << kern->getBytesWriteAllocatePerRep()
         << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep()
         << endl;
   }
@@ -867,6 +901,10 @@ void Executor::runSuite()
   }
 
 
+  if ( run_params.getAutotune() ) {
+    autotuneKernels();
+  }
+
   getCout() << "\n\nRunning specified kernels and variants...\n";
 
   const int npasses = run_params.getNumPasses();
@@ -910,6 +948,10 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
 
     for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
 
+      if ( !isAutotuneTuning(kernel, vid, tune_idx) ) {
+        continue;
+      }
+
       if ( run_params.showProgress() ) {
         getCout() << "     Running "
                   << kernel->getVariantTuningName(vid, tune_idx) << " tuning";
@@ -922,6 +964,220 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
   } // loop over variants
 }
 
+void Executor::autotuneKernels()
+{
+  autotune_host = getRunHostName();
+  readAutotuneCache();
+
+  getCout() << "\n\nAutotuning specified kernels and variants...\n";
+
+  bool cache_changed = false;
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kernel = kernels[ik];
+
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+
+      if ( kernel->getNumVariantTunings(vid) < 2 ) {
+        continue;
+      }
+
+      std::string key = getAutotuneKey(kernel, vid);
+      auto cached = autotune_cache.find(key);
+      if ( !run_params.getRetune() &&
+           cached != autotune_cache.end() &&
+           kernel->hasVariantTuningDefined(vid, cached->second) ) {
+        if ( run_params.showProgress() ) {
+          getCout() << "   " << kernel->getName() << " "
+                    << getVariantName(vid) << " cached tuning -- "
+                    << cached->second << endl;
+        }
+        continue;
+      }
+
+      size_t best_tune_idx = searchVariantTunings(kernel, vid);
+      autotune_cache[key] = kernel->getVariantTuningName(vid, best_tune_idx);
+      cache_changed = true;
+
+      getCout() << "   " << kernel->getName() << " " << getVariantName(vid)
+                << " best tuning -- "
+                << kernel->getVariantTuningName(vid, best_tune_idx) << endl;
+    }
+  }
+
+  if ( cache_changed ) {
+    writeAutotuneCache();
+  }
+}
+
+size_t Executor::searchVariantTunings(KernelBase* kernel, VariantID vid)
+{
+  const size_t num_tunings = kernel->getNumVariantTunings(vid);
+
+  std::vector<size_t> candidates(num_tunings);
+  std::iota(candidates.begin(), candidates.end(), 0);
+
+  std::vector<double> best_time(num_tunings, std::numeric_limits<double>::max());
+
+  auto run_candidates = [&]() {
+    for (size_t tune_idx : candidates) {
+      kernel->execute(vid, tune_idx);
+      double time = kernel->getLastTime();
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+      double max_time = time;
+      MPI_Allreduce(&time, &max_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      time = max_time;
+#endif
+      best_time[tune_idx] = std::min(best_time[tune_idx], time);
+      if ( run_params.showProgress() ) {
+        getCout() << "     Searching " << getVariantName(vid) << " "
+                  << kernel->getVariantTuningName(vid, tune_idx)
+                  << " tuning -- " << time << " sec." << endl;
+      }
+    }
+  };
+
+  auto faster = [&](size_t lhs, size_t rhs) {
+    return best_time[lhs] < best_time[rhs];
+  };
+
+  if ( num_tunings <= autotune_exhaustive_max_tunings ) {
+
+    const int npasses = run_params.getNumPasses();
+    for (int ip = 0; ip < npasses; ++ip) {
+      run_candidates();
+    }
+
+  } else {
+
+    //
+    // Successive halving, each round times the remaining tunings once
+    // more and keeps the faster half.
+    //
+    while ( candidates.size() > 1 ) {
+      run_candidates();
+      std::stable_sort(candidates.begin(), candidates.end(), faster);
+      candidates.resize((candidates.size() + 1) / 2);
+    }
+
+  }
+
+  size_t best_tune_idx =
+      *std::min_element(candidates.begin(), candidates.end(), faster);
+
+  kernel->resetVariantTuningRunData(vid);
+
+  return best_tune_idx;
+}
+
+std::string Executor::getAutotuneKey(KernelBase* kernel, VariantID vid) const
+{
+  return autotune_host + " " + kernel->getName() + " " +
+         getVariantName(vid) + " " +
+         std::to_string(kernel->getActualProblemSize()) + " " +
+         getInputDistributionName(run_params.getInputDistribution());
+}
+
+bool Executor::isAutotuneTuning(KernelBase* kernel, VariantID vid,
+                                size_t tune_idx) const
+{
+  if ( !run_params.getAutotune() ) {
+    return true;
+  }
+  auto cached = autotune_cache.find(getAutotuneKey(kernel, vid));
+  if ( cached == autotune_cache.end() ||
+       !kernel->hasVariantTuningDefined(vid, cached->second) ) {
+    return true;
+  }
+  return cached->second == kernel->getVariantTuningName(vid, tune_idx);
+}
+
+//
+// Autotune cache file has a line for each kernel variant searched,
+// "host kernel variant problem_size input_distribution tuning", lines starting with # are
+// comments. Rank 0 reads and writes the file when using MPI.
+//
+void Executor::readAutotuneCache()
+{
+  int rank = 0;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  std::string contents;
+  if ( rank == 0 ) {
+    ifstream file(run_params.getAutotuneCacheFileName());
+    if ( file ) {
+      stringstream buffer;
+      buffer << file.rdbuf();
+      contents = buffer.str();
+    }
+  }
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  unsigned long long length = contents.size();
+  MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+  contents.resize(length);
+  MPI_Bcast(&contents[0], length, MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+
+  istringstream lines(contents);
+  string line;
+  while ( getline(lines, line) ) {
+    if ( line.empty() || line[0] == '#' ) {
+      continue;
+    }
+    istringstream entry(line);
+    string host, kernel_name, variant_name, size, dist_name, tuning_name;
+    if ( entry >> host >> kernel_name >> variant_name >> size >> dist_name
+               >> tuning_name ) {
+      autotune_cache[host + " " + kernel_name + " " + variant_name + " " +
+                     size + " " + dist_name] = tuning_name;
+    }
+  }
+}
+
+void Executor::writeAutotuneCache() const
+{
+  int rank = 0;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  if ( rank != 0 ) {
+    return;
+  }
+
+  ofstream file(run_params.getAutotuneCacheFileName(), ios::out | ios::trunc);
+  if ( !file ) {
+    getCout() << " ERROR: Can't open autotune cache file "
+              << run_params.getAutotuneCacheFileName() << endl;
+    return;
+  }
+
+  file << "# host kernel variant problem_size input_distribution tuning" << endl;
+  for (auto const& key_tuning : autotune_cache) {
+    file << key_tuning.first << " " << key_tuning.second << endl;
+  }
+}
+
+size_t Executor::getReferenceTuneIdx(KernelBase* kernel) const
+{
+  //
+  // In autotune mode compare against the tuning of the reference variant
+  // that was run.
+  //
+  if ( run_params.getAutotune() && reference_vid < NumVariants ) {
+    for (size_t tune_idx = 0;
+         tune_idx < kernel->getNumVariantTunings(reference_vid); ++tune_idx) {
+      if ( kernel->wasVariantTuningRun(reference_vid, tune_idx) ) {
+        return tune_idx;
+      }
+    }
+  }
+  return reference_tune_idx;
+}
+
 void Executor::outputRunData()
 {
   RunParams::InputOpt in_state = run_params.getInputState();
@@ -953,6 +1209,15 @@ void Executor::outputRunData()
       file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
       writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
     }
+
+    file = openOutputFile(out_fprefix + "-bandwidth-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Bandwidth, combiner, 3 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-bandwidth-actual-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::ActualBandwidth, combiner, 3 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-flops-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::FLOPRate, combiner, 3 /* prec */);
   }
 
   file = openOutputFile(out_fprefix + "-checksum.txt");
@@ -1066,17 +1331,17 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
         for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
           std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
           file << sepchr <<right<< setw(vartuncol_width[iv][it]);
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
           if ( (mode == CSVRepMode::Speedup) &&
-               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
-                !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
+               (!kern->wasVariantTuningRun(reference_vid, getReferenceTuneIdx(kern)) ||
+                !kern->wasVariantTuningRun(vid, tune_idx)) ) {
             file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
-                      !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+          } else if ( (mode != CSVRepMode::Speedup) &&
+                      !kern->wasVariantTuningRun(vid, tune_idx) ) {
             file << "Not run";
           } else {
             file << setprecision(prec) << std::fixed
-                 << getReportDataEntry(mode, combiner, kern, vid,
-                        kern->getVariantTuningIndex(vid, tuning_name));
+                 << getReportDataEntry(mode, combiner, kern, vid, tune_idx);
           }
         }
       }
@@ -1389,6 +1654,7 @@ void Executor::writeChecksumReport(ostream& file)
 
     size_t prec = 20;
     size_t checksum_width = prec + 8;
+    size_t tolerance_width = 12;
 
     size_t namecol_width = 0;
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
@@ -1429,6 +1695,7 @@ void Executor::writeChecksumReport(ostream& file)
          <<left<< setw(checksum_width) << "Checksum  "
          <<left<< setw(checksum_width) << "Checksum Diff  "
 #endif
+         <<left<< setw(tolerance_width) << "Tolerance  "
          << endl;
     file <<left<< setw(namecol_width) << "  "
          <<left<< setw(checksum_width) << "  "
@@ -1436,6 +1703,7 @@ void Executor::writeChecksumReport(ostream& file)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
          <<left<< setw(checksum_width) << ""
 #endif
+         <<left<< setw(tolerance_width) << "(relative, 'OVER_TOL' to right if diff is over tolerance)"
          << endl;
     file << dash_line << endl;
 
@@ -1574,11 +1842,25 @@ void Executor::writeChecksumReport(ostream& file)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
                  <<left<< setw(checksum_width) << checksums_avg[iv][tune_idx]
                  <<left<< setw(checksum_width) << checksums_abs_diff_max[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx] << endl;
+                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx];
+            Checksum_type cksum_diff = checksums_abs_diff_max[iv][tune_idx];
 #else
                  <<left<< setw(checksum_width) << checksums[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx] << endl;
+                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx];
+            Checksum_type cksum_diff = checksums_diff[iv][tune_idx];
 #endif
+            //
+            // Tunings that trade accuracy for speed give their tolerance,
+            // exact tunings leave the column empty.
+            //
+            Checksum_type cksum_tol = kern->getChecksumTolerance(vid, tune_idx);
+            if ( cksum_tol > 0.0 ) {
+              file <<left<< setw(tolerance_width) << setprecision(3) << cksum_tol;
+              if ( std::abs(cksum_diff) > cksum_tol * std::abs(cksum_ref) ) {
+                file << "OVER_TOL";
+              }
+            }
+            file << endl;
           } else {
             file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
@@ -1635,6 +1917,18 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       }
       break;
     }
+    case CSVRepMode::Bandwidth : {
+      title += string("Bandwidth Report (GB/s of bytes/rep) ");
+      break;
+    }
+    case CSVRepMode::ActualBandwidth : {
+      title += string("Actual Bandwidth Report (GB/s of bytes/rep plus write-allocate bytes/rep) ");
+      break;
+    }
+    case CSVRepMode::FLOPRate : {
+      title += string("FLOP Rate Report (GFLOP/s of FLOPs/rep) ");
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return title;
@@ -1668,21 +1962,22 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
     }
     case CSVRepMode::Speedup : {
       if ( haveReferenceVariant() ) {
-        if ( kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) &&
+        size_t ref_tune_idx = getReferenceTuneIdx(kern);
+        if ( kern->hasVariantTuningDefined(reference_vid, ref_tune_idx) &&
              kern->hasVariantTuningDefined(vid, tune_idx) ) {
           switch ( combiner ) {
             case RunParams::CombinerOpt::Average : {
-              retval = kern->getTotTime(reference_vid, reference_tune_idx) /
+              retval = kern->getTotTime(reference_vid, ref_tune_idx) /
                        kern->getTotTime(vid, tune_idx);
             }
             break;
             case RunParams::CombinerOpt::Minimum : {
-              retval = kern->getMinTime(reference_vid, reference_tune_idx) /
+              retval = kern->getMinTime(reference_vid, ref_tune_idx) /
                        kern->getMinTime(vid, tune_idx);
             }
             break;
             case RunParams::CombinerOpt::Maximum : {
-              retval = kern->getMaxTime(reference_vid, reference_tune_idx) /
+              retval = kern->getMaxTime(reference_vid, ref_tune_idx) /
                        kern->getMaxTime(vid, tune_idx);
             }
             break;
@@ -1695,13 +1990,35 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
         getCout() << "Kernel(iv): " << kern->getName() << "(" << vid << ")"
                                                        << "(" << tune_idx << ")"endl;
         getCout() << "\tref_time, tot_time, retval = "
-             << kern->getTotTime(reference_vid, reference_tune_idx) << " , "
+             << kern->getTotTime(reference_vid, ref_tune_idx) << " , "
              << kern->getTotTime(vid, tune_idx) << " , "
              << retval << endl;
 #endif
       }
       break;
     }
+    case CSVRepMode::Bandwidth :
+    case CSVRepMode::ActualBandwidth : {
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      Index_type bytes = ( mode == CSVRepMode::Bandwidth )
+                         ? kern->getBytesPerRep(vid, tune_idx)
+                         : kern->getActualBytesPerRep(vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = static_cast<long double>(bytes) * kern->getRunReps() /
+                 time / 1.0e9;
+      }
+      break;
+    }
+    case CSVRepMode::FLOPRate : {
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = static_cast<long double>(kern->getFLOPsPerRep(vid, tune_idx)) *
+                 kern->getRunReps() / time / 1.0e9;
+      }
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return retval;
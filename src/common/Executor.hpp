@@ -17,6 +17,8 @@
 #include <memory>
 #include <utility>
 #include <set>
+#include <map>
+#include <string>
 
 namespace rajaperf {
 
@@ -52,6 +54,9 @@ private:
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    Bandwidth,
+    ActualBandwidth,
+    FLOPRate,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -65,9 +70,17 @@ private:
 
   void runKernel(KernelBase* kern, bool print_kernel_name);
 
+  void autotuneKernels();
+  size_t searchVariantTunings(KernelBase* kern, VariantID vid);
+  std::string getAutotuneKey(KernelBase* kern, VariantID vid) const;
+  bool isAutotuneTuning(KernelBase* kern, VariantID vid, size_t tune_idx) const;
+  void readAutotuneCache();
+  void writeAutotuneCache() const;
+
   std::unique_ptr<std::ostream> openOutputFile(const std::string& filename) const;
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
+  size_t getReferenceTuneIdx(KernelBase* kern) const;
 
   void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
 
@@ -90,6 +103,10 @@ private:
   VariantID reference_vid;
   size_t    reference_tune_idx;
 
+  std::string autotune_host;
+  std::map<std::string, std::string> autotune_cache; /*!< best tuning name for
+                                                           each autotune key */
+
 public:
   // Methods for verification testing in CI.
   std::vector<KernelBase*> getKernels() const { return kernels; }
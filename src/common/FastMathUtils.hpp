@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Inline math routines used by the fast math tunings of kernels that
+/// call transcendental functions.
+///
+/// The routines are written with plain arithmetic and bit manipulation
+/// so the compiler can inline and vectorize the loops that use them
+/// without libm calls or fast-math compiler flags. Each one documents
+/// its error bound, the checksum tolerance of a tuning using it is set
+/// from that bound so the accuracy lost is reported next to the time
+/// gained.
+///
+/// The routines build and read the bits of a double and are only defined
+/// when Real_type is double, the fast math tunings are not added to float
+/// builds.
+///
+
+#ifndef RAJAPerf_FastMathUtils_HPP
+#define RAJAPerf_FastMathUtils_HPP
+
+#include "RPTypes.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(RP_USE_DOUBLE)
+
+namespace rajaperf
+{
+
+static_assert(std::is_same<Real_type, double>::value &&
+              sizeof(Real_type) == sizeof(std::int64_t),
+              "FastMathUtils routines require a 64-bit double Real_type");
+
+/*!
+ * \brief Exponential function evaluated with a polynomial.
+ *
+ * x is split as k*ln(2) + r with |r| <= ln(2)/2 using a two part ln(2),
+ * e^r is the degree 12 Taylor polynomial and 2^k is built in the exponent
+ * bits. The relative error is below 1e-15 for x in [-708, 709], x is
+ * clamped to that range so results are finite and normal.
+ */
+inline Real_type polyExp(Real_type x)
+{
+  const Real_type log2e  = 1.4426950408889634;
+  const Real_type ln2_hi = 6.93147180369123816490e-01;
+  const Real_type ln2_lo = 1.90821492927058770002e-10;
+  const Real_type round  = 6755399441055744.0; // 1.5 * 2^52
+
+  x = ( x < -708.0 ) ? -708.0 : x;
+  x = ( x > 709.0 ) ? 709.0 : x;
+
+  const Real_type k = ( x * log2e + round ) - round;
+  const Real_type r = ( x - k * ln2_hi ) - k * ln2_lo;
+
+  Real_type p = 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  const std::int64_t bits =
+    ( static_cast<std::int64_t>(k) + 1023 ) << 52;
+  Real_type scale;
+  std::memcpy(&scale, &bits, sizeof(scale));
+
+  return p * scale;
+}
+
+/*!
+ * \brief Reciprocal square root of positive x from a bit manipulation
+ *        initial guess refined by newton_iters Newton iterations.
+ *
+ * The initial guess has a relative error of at most 3.5e-2 and each
+ * iteration roughly squares it, the error is below 2e-3, 5e-6, 4e-11
+ * after 1, 2, 3 iterations and at rounding level after 4. Results are
+ * always at or below 1/sqrt(x) until they reach rounding level.
+ */
+template < int newton_iters >
+inline Real_type rsqrtNewton(Real_type x)
+{
+  std::int64_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  bits = 0x5FE6EB50C7B537A9 - ( bits >> 1 );
+  Real_type y;
+  std::memcpy(&y, &bits, sizeof(y));
+
+  const Real_type half_x = 0.5 * x;
+  for (int n = 0; n < newton_iters; ++n) {
+    y = y * ( 1.5 - half_x * y * y );
+  }
+  return y;
+}
+
+/*!
+ * \brief Relative checksum tolerance of tunings summing results of
+ *        rsqrtNewton<newton_iters>.
+ *
+ * Every term of the sum has the same sign of error so the relative error
+ * of the sum is bounded by that of a single term.
+ */
+template < int newton_iters >
+Checksum_type getRsqrtNewtonChecksumTolerance();
+///
+template < >
+inline Checksum_type getRsqrtNewtonChecksumTolerance<2>()
+{
+  return 1.0e-5;
+}
+///
+template < >
+inline Checksum_type getRsqrtNewtonChecksumTolerance<3>()
+{
+  return 1.0e-10;
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RP_USE_DOUBLE
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,269 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and classes for host kernel templates.
+///
+/// Host tuning parameters work like the GPU block size tunings. A kernel
+/// lists the values of a parameter it supports at compile time and each
+/// value in the list that passes the run time filter of the parameter
+/// becomes a "<name>_<value>" tuning of the kernel's Seq and OpenMP
+/// variants. Unlike a GPU block size a kernel may give several default
+/// values, the cmake list of a parameter replaces the defaults of every
+/// kernel when it is set.
+///
+///   parameter          name        cmake variable / run time option
+///   tile_size          "tile"      RAJA_PERFSUITE_HOST_TILE_SIZES
+///                                  --host_tile_size
+///   unroll             "unroll"    RAJA_PERFSUITE_HOST_UNROLLS
+///                                  --host_unroll
+///   chunk_size         "chunk"     RAJA_PERFSUITE_HOST_CHUNK_SIZES
+///                                  --host_chunk_size
+///   prefetch_distance  "prefetch"  RAJA_PERFSUITE_PREFETCH_DISTANCES
+///                                  --prefetch_distance
+///
+/// The bitmask helpers are used by the stream compaction tunings that keep
+/// one bit per element and expand the set bits into an index list.
+///
+/// The streaming store helpers are used by the "nontemporal" tunings of the
+/// stream kernels, stored cache lines are written without being read first.
+///
+/// The prefetch helpers are used by the "prefetch_<N>" tunings, which
+/// prefetch the data used N loop iterations ahead.
+///
+
+#ifndef RAJAPerf_HostUtils_HPP
+#define RAJAPerf_HostUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#if defined(__x86_64__) && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace host_tuning
+{
+
+// validity checkers shared with gpu block sizes
+using gpu_block_size::AllowAny;
+using gpu_block_size::MultipleOf;
+
+// true if I is a power of two, false otherwise
+struct PowerOfTwo
+{
+  template < size_t I >
+  static constexpr bool valid() { return (I != 0) && ((I & (I - 1)) == 0); }
+};
+
+//
+// Host tuning parameters, name is the prefix of the parameter's tuning
+// names and the key of its run time filter in RunParams, configured_list
+// is the list of values given to cmake.
+//
+struct tile_size
+{
+  static const char* name() { return "tile"; }
+  using configured_list = rajaperf::configuration::host_tile_sizes;
+};
+
+struct unroll
+{
+  static const char* name() { return "unroll"; }
+  using configured_list = rajaperf::configuration::host_unrolls;
+};
+
+struct chunk_size
+{
+  static const char* name() { return "chunk"; }
+  using configured_list = rajaperf::configuration::host_chunk_sizes;
+};
+
+struct prefetch_distance
+{
+  static const char* name() { return "prefetch"; }
+  using configured_list = rajaperf::configuration::prefetch_distances;
+};
+
+template < size_t... values >
+using list_type = camp::int_seq<size_t, values...>;
+
+// A list of values of param made from the values configured by cmake if
+// any were given, otherwise from the given default_list. Values for which
+// validity_checker::valid<I>() is false are removed from the list.
+template < typename param, typename default_list,
+           typename validity_checker = AllowAny >
+using make_list_type =
+      typename gpu_block_size::detail::remove_invalid<validity_checker,
+        typename std::conditional< (gpu_block_size::detail::SizeOfIntSeq<typename param::configured_list>::size > 0),
+          typename param::configured_list,
+          default_list
+        >::type
+      >::type;
+
+// name of the tuning using value for param
+template < typename param >
+inline std::string tuning_name(size_t value)
+{
+  return std::string(param::name()) + "_" + std::to_string(value);
+}
+
+// calls func(value) with the value in values_type of the param tuning
+// named name, returns false if name is not one of those tunings
+template < typename param, typename values_type, typename Func >
+inline bool run_tuning(const std::string& name, Func&& func)
+{
+  bool found = false;
+  seq_for(values_type{}, [&](auto value) {
+    if ( !found && name == tuning_name<param>(value) ) {
+      func(value);
+      found = true;
+    }
+  });
+  return found;
+}
+
+} // closing brace for host_tuning namespace
+
+namespace bitmask
+{
+
+// Word of bits used by the bitmask host kernel tunings, bit b of word w
+// corresponds to index w*word_bits + b.
+using word_type = unsigned long long;
+
+constexpr Index_type word_bits = 64;
+
+// number of words needed to hold len bits
+inline Index_type num_words(Index_type len)
+{
+  return (len + word_bits - 1) / word_bits;
+}
+
+// number of set bits in word
+inline Index_type popcount(word_type word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  Index_type count = 0;
+  for ( ; word != 0; word &= word - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+// index of the lowest set bit in word, word must not be 0
+inline Index_type lowest_bit(word_type word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  Index_type bit = 0;
+  for ( ; (word & 1u) == 0; word >>= 1) {
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+} // closing brace for bitmask namespace
+
+namespace streaming_store
+{
+
+// true if store emits non-temporal stores, otherwise it is a plain store
+// and kernels do not define their streaming store tunings
+#if defined(__clang__) || (defined(__x86_64__) && defined(__SSE2__))
+constexpr bool available = true;
+#else
+constexpr bool available = false;
+#endif
+
+#if !defined(__clang__) && defined(__x86_64__) && defined(__SSE2__)
+// SSE2 streams integers, Real_type is stored as an integer of its size
+inline void stream_bits(int* ptr, int bits) { _mm_stream_si32(ptr, bits); }
+inline void stream_bits(long long* ptr, long long bits) { _mm_stream_si64(ptr, bits); }
+
+using bits_type = typename std::conditional<sizeof(Real_type) == sizeof(int),
+                                            int, long long>::type;
+static_assert(sizeof(bits_type) == sizeof(Real_type),
+              "streaming_store requires a 4 or 8 byte Real_type");
+#endif
+
+// store val to ptr with a non-temporal store that bypasses the caches
+inline void store(Real_type* ptr, Real_type val)
+{
+#if defined(__clang__)
+  __builtin_nontemporal_store(val, ptr);
+#elif defined(__x86_64__) && defined(__SSE2__)
+  bits_type bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  stream_bits(reinterpret_cast<bits_type*>(ptr), bits);
+#else
+  *ptr = val;
+#endif
+}
+
+// non-temporal stores are weakly ordered, each thread calls fence after
+// its last streaming store so they are visible to other threads after
+// the next barrier
+inline void fence()
+{
+#if defined(__x86_64__) && defined(__SSE2__)
+  _mm_sfence();
+#endif
+}
+
+} // closing brace for streaming_store namespace
+
+namespace prefetch
+{
+
+// true if read and write emit prefetch instructions, otherwise they do
+// nothing and kernels do not define their prefetch distance tunings
+#if defined(__GNUC__) || defined(__clang__)
+constexpr bool available = true;
+#else
+constexpr bool available = false;
+#endif
+
+// hint that the cache line holding ptr will be read soon
+inline void read(const void* ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr, 0, 3);
+#else
+  (void) ptr;
+#endif
+}
+
+// hint that the cache line holding ptr will be written soon
+inline void write(void* ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr, 1, 3);
+#else
+  (void) ptr;
+#endif
+}
+
+} // closing brace for prefetch namespace
+
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -10,6 +10,7 @@
 
 #include "RunParams.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -33,6 +34,7 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   its_per_rep = -1;
   kernels_per_rep = -1;
   bytes_per_rep = -1;
+  bytes_write_allocate_per_rep = 0;
   FLOPs_per_rep = -1;
 
   running_variant = NumVariants;
@@ -165,6 +167,15 @@ void KernelBase::execute(VariantID vid, size_t tune_idx)
   running_tuning = getUnknownTuningIdx();
 }
 
+void KernelBase::resetVariantTuningRunData(VariantID vid)
+{
+  std::fill(checksum[vid].begin(), checksum[vid].end(), 0.0);
+  std::fill(num_exec[vid].begin(), num_exec[vid].end(), 0);
+  std::fill(min_time[vid].begin(), min_time[vid].end(), std::numeric_limits<double>::max());
+  std::fill(max_time[vid].begin(), max_time[vid].end(), -std::numeric_limits<double>::max());
+  std::fill(tot_time[vid].begin(), tot_time[vid].end(), 0.0);
+}
+
 void KernelBase::recordExecTime()
 {
   num_exec[running_variant].at(running_tuning)++;
@@ -273,6 +284,7 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t its_per_rep = " << its_per_rep << std::endl;
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
+  os << "\t\t\t bytes_write_allocate_per_rep = " << bytes_write_allocate_per_rep << std::endl;
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
@@ -14,6 +14,7 @@
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
 #include "common/GPUUtils.hpp"
+#include "common/HostUtils.hpp"
 
 #include "RAJA/util/Timer.hpp"
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
@@ -65,12 +66,57 @@ public:
   void setItsPerRep(Index_type its) { its_per_rep = its; };
   void setKernelsPerRep(Index_type nkerns) { kernels_per_rep = nkerns; };
   void setBytesPerRep(Index_type bytes) { bytes_per_rep = bytes;}
+  // bytes read to fill the cache lines of stored data before they are
+  // written, moved by the hardware but not counted in bytes per rep,
+  // tunings with streaming (non-temporal) stores do not move them
+  void setBytesWriteAllocatePerRep(Index_type bytes) { bytes_write_allocate_per_rep = bytes; }
   void setFLOPsPerRep(Index_type FLOPs) { FLOPs_per_rep = FLOPs; }
 
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
   void setVariantDefined(VariantID vid);
   void addVariantTuningName(VariantID vid, std::string name)
-  { variant_tuning_names[vid].emplace_back(std::move(name)); }
+  { addVariantTuningName(vid, std::move(name), 0.0); }
+  // checksum_tolerance is relative to the reference checksum, it is zero
+  // for tunings expected to match the reference checksum exactly
+  void addVariantTuningName(VariantID vid, std::string name,
+                            Checksum_type checksum_tolerance)
+  {
+    variant_tuning_names[vid].emplace_back(std::move(name));
+    variant_tuning_checksum_tolerances[vid].emplace_back(checksum_tolerance);
+    variant_tuning_streaming_stores[vid].emplace_back(false);
+    variant_tuning_bytes_per_rep[vid].emplace_back(-1);
+    variant_tuning_bytes_write_allocate_per_rep[vid].emplace_back(-1);
+    variant_tuning_FLOPs_per_rep[vid].emplace_back(-1);
+  }
+  // add a tuning named host_tuning::tuning_name<param>(value) for each value
+  // in values_type that passes the run time filter of param
+  template < typename param, typename values_type >
+  void addVariantHostTuningNames(VariantID vid)
+  {
+    seq_for(values_type{}, [&](auto value) {
+      if ( run_params.validHostTuningValue(param::name(), value) ) {
+        addVariantTuningName(vid, host_tuning::tuning_name<param>(value));
+      }
+    });
+  }
+  // mark an added tuning as using streaming stores
+  void setVariantTuningStreamingStores(VariantID vid, std::string const& name)
+  { variant_tuning_streaming_stores[vid].at(getVariantTuningIndex(vid, name)) = true; }
+  // set the bytes per rep of an added tuning that moves a different amount
+  // of data than the other tunings of the kernel
+  void setVariantTuningBytesPerRep(VariantID vid, std::string const& name,
+                                   Index_type bytes)
+  { variant_tuning_bytes_per_rep[vid].at(getVariantTuningIndex(vid, name)) = bytes; }
+  // set the write-allocate bytes per rep of an added tuning that stores a
+  // different amount of data than the other tunings of the kernel
+  void setVariantTuningBytesWriteAllocatePerRep(VariantID vid, std::string const& name,
+                                                Index_type bytes)
+  { variant_tuning_bytes_write_allocate_per_rep[vid].at(getVariantTuningIndex(vid, name)) = bytes; }
+  // set the FLOPs per rep of an added tuning that does a different number
+  // of operations than the other tunings of the kernel
+  void setVariantTuningFLOPsPerRep(VariantID vid, std::string const& name,
+                                   Index_type FLOPs)
+  { variant_tuning_FLOPs_per_rep[vid].at(getVariantTuningIndex(vid, name)) = FLOPs; }
 
   virtual void setSeqTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
@@ -102,7 +148,33 @@ public:
   Index_type getItsPerRep() const { return its_per_rep; };
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
+  Index_type getBytesWriteAllocatePerRep() const { return bytes_write_allocate_per_rep; }
+  // bytes per rep of the given tuning
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const
+  {
+    Index_type bytes = variant_tuning_bytes_per_rep[vid].at(tune_idx);
+    return ( bytes < 0 ) ? bytes_per_rep : bytes;
+  }
+  // write-allocate bytes per rep of the given tuning
+  Index_type getBytesWriteAllocatePerRep(VariantID vid, size_t tune_idx) const
+  {
+    Index_type bytes = variant_tuning_bytes_write_allocate_per_rep[vid].at(tune_idx);
+    return ( bytes < 0 ) ? bytes_write_allocate_per_rep : bytes;
+  }
+  // bytes moved per rep by the given tuning including write-allocate
+  Index_type getActualBytesPerRep(VariantID vid, size_t tune_idx) const
+  {
+    return variant_tuning_streaming_stores[vid].at(tune_idx)
+           ? getBytesPerRep(vid, tune_idx)
+           : getBytesPerRep(vid, tune_idx) + getBytesWriteAllocatePerRep(vid, tune_idx);
+  }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
+  // FLOPs per rep of the given tuning
+  Index_type getFLOPsPerRep(VariantID vid, size_t tune_idx) const
+  {
+    Index_type FLOPs = variant_tuning_FLOPs_per_rep[vid].at(tune_idx);
+    return ( FLOPs < 0 ) ? FLOPs_per_rep : FLOPs;
+  }
 
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
@@ -163,9 +235,14 @@ public:
   double getMaxTime(VariantID vid, size_t tune_idx) const { return max_time[vid].at(tune_idx); }
   double getTotTime(VariantID vid, size_t tune_idx) { return tot_time[vid].at(tune_idx); }
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const { return checksum[vid].at(tune_idx); }
+  Checksum_type getChecksumTolerance(VariantID vid, size_t tune_idx) const { return variant_tuning_checksum_tolerances[vid].at(tune_idx); }
 
   void execute(VariantID vid, size_t tune_idx);
 
+  // discard checksums and timers of all tunings of given variant, used to
+  // drop executions done while searching for the best tuning
+  void resetVariantTuningRunData(VariantID vid);
+
   void synchronize()
   {
 #if defined(RAJA_ENABLE_CUDA)
@@ -256,6 +333,11 @@ private:
   bool uses_feature[NumFeatures];
 
   std::vector<std::string> variant_tuning_names[NumVariants];
+  std::vector<Checksum_type> variant_tuning_checksum_tolerances[NumVariants];
+  std::vector<bool> variant_tuning_streaming_stores[NumVariants];
+  std::vector<Index_type> variant_tuning_bytes_per_rep[NumVariants];
+  std::vector<Index_type> variant_tuning_bytes_write_allocate_per_rep[NumVariants];
+  std::vector<Index_type> variant_tuning_FLOPs_per_rep[NumVariants];
 
   //
   // Properties of kernel dependent on how kernel is run
@@ -263,6 +345,7 @@ private:
   Index_type its_per_rep;
   Index_type kernels_per_rep;
   Index_type bytes_per_rep;
+  Index_type bytes_write_allocate_per_rep;
   Index_type FLOPs_per_rep;
 
   VariantID running_variant;
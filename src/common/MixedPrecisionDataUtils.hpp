@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Storage types and methods for kernel data used by the mixed precision
+/// "float" and "bfloat16" tunings.
+///
+/// These tunings keep a kernel's data in a reduced precision storage type
+/// while all arithmetic, and any value accumulated over reps, stays in
+/// Real_type. Data is initialized in Real_type as for the other tunings,
+/// copied to the storage type before the timed region and copied back
+/// after it so the checksum measures the accuracy lost to the storage
+/// type. The checksum tolerance of each storage type bounds that loss
+/// relative to the reference checksum. Each kernel sets the bytes per rep
+/// of its storage tunings from sizeof(StorageT) for the arrays it keeps in
+/// the storage type.
+///
+
+#ifndef RAJAPerf_MixedPrecisionDataUtils_HPP
+#define RAJAPerf_MixedPrecisionDataUtils_HPP
+
+#include "RAJAPerfSuite.hpp"
+#include "RPTypes.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Storage only brain floating point type, the upper 16 bits of
+ *        an IEEE single precision value.
+ *
+ * Values are rounded to nearest even when stored and are converted to
+ * Real_type when read, so all arithmetic is done in Real_type.
+ */
+struct BFloat16
+{
+  BFloat16() = default;
+
+  BFloat16(Real_type val)
+    : bits(fromFloat(static_cast<float>(val)))
+  { }
+
+  operator Real_type() const
+  {
+    return static_cast<Real_type>(toFloat(bits));
+  }
+
+  static std::uint16_t fromFloat(float val)
+  {
+    std::uint32_t u;
+    std::memcpy(&u, &val, sizeof(u));
+    if ( (u & 0x7fffffffu) > 0x7f800000u ) {
+      return static_cast<std::uint16_t>((u >> 16) | 0x0040u); // quiet NaN
+    }
+    u += 0x7fffu + ((u >> 16) & 1u);
+    return static_cast<std::uint16_t>(u >> 16);
+  }
+
+  static float toFloat(std::uint16_t b)
+  {
+    std::uint32_t u = static_cast<std::uint32_t>(b) << 16;
+    float val;
+    std::memcpy(&val, &u, sizeof(val));
+    return val;
+  }
+
+  std::uint16_t bits;
+};
+
+/*!
+ * \brief Relative checksum tolerance of tunings using storage type T.
+ *
+ * Inputs and results are each rounded once to T so the relative error
+ * of a checksum of positive values is a small multiple of T's unit
+ * roundoff (2^-24 for float, 2^-9 for bfloat16).
+ */
+template < typename T >
+Checksum_type getStorageChecksumTolerance();
+///
+template < >
+inline Checksum_type getStorageChecksumTolerance<float>()
+{
+  return 1.0e-5;
+}
+///
+template < >
+inline Checksum_type getStorageChecksumTolerance<BFloat16>()
+{
+  return 1.0e-2;
+}
+
+/*!
+ * \brief Allocate storage data array (sptr) and copy given Real_type
+ *        data (hptr) to it, converting to the storage type.
+ *
+ * The array is aligned like the Real_type data of the kernel and the
+ * copy is done in parallel for OpenMP variants so the first touch of the
+ * storage data matches the other data of the kernel.
+ */
+template < typename T >
+void allocAndInitStorageData(T*& sptr, const Real_ptr hptr, int len,
+                             VariantID vid)
+{
+  sptr = RAJA::allocate_aligned_type<T>(RAJA::DATA_ALIGN, len*sizeof(T));
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      sptr[i] = T(hptr[i]);
+    }
+    return;
+  }
+#else
+  (void) vid;
+#endif
+
+  for (int i = 0; i < len; ++i) {
+    sptr[i] = T(hptr[i]);
+  }
+}
+
+/*!
+ * \brief Copy given storage data (sptr) to Real_type data (hptr).
+ */
+template < typename T >
+void getStorageData(Real_ptr hptr, const T* sptr, int len)
+{
+  for (int i = 0; i < len; ++i) {
+    hptr[i] = static_cast<Real_type>(sptr[i]);
+  }
+}
+
+/*!
+ * \brief Free storage data array.
+ */
+template < typename T >
+void deallocStorageData(T*& sptr)
+{
+  if (sptr) {
+    RAJA::free_aligned(sptr);
+    sptr = nullptr;
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -79,7 +79,7 @@
 // Apps kernels...
 //
 #include "apps/CONVECTION3DPA.hpp"
-#include "apps/WIP-COUPLE.hpp"
+#include "apps/COUPLE.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
 #include "apps/ENERGY.hpp"
@@ -91,6 +91,7 @@
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
 #include "apps/PRESSURE.hpp"
+#include "apps/SPMV.hpp"
 #include "apps/VOL3D.hpp"
 
 //
@@ -100,6 +101,15 @@
 #include "algorithm/SORT.hpp"
 #include "algorithm/SORTPAIRS.hpp"
 #include "algorithm/REDUCE_SUM.hpp"
+#include "algorithm/SEGMENTED_SCAN.hpp"
+#include "algorithm/SEGMENTED_REDUCE.hpp"
+
+//
+// Memory kernels...
+//
+#include "memory/POINTER_CHASE.hpp"
+#include "memory/RANDOM_GATHER.hpp"
+#include "memory/STRIDED_READ.hpp"
 
 
 #include <iostream>
@@ -127,6 +137,7 @@ static const std::string GroupNames [] =
   std::string("Stream"),
   std::string("Apps"),
   std::string("Algorithm"),
+  std::string("Memory"),
 
   std::string("Unknown Group")  // Keep this at the end and DO NOT remove....
 
@@ -225,6 +236,7 @@ static const std::string KernelNames [] =
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
   std::string("Apps_PRESSURE"),
+  std::string("Apps_SPMV"),
   std::string("Apps_VOL3D"),
 
 //
@@ -234,6 +246,15 @@ static const std::string KernelNames [] =
   std::string("Algorithm_SORT"),
   std::string("Algorithm_SORTPAIRS"),
   std::string("Algorithm_REDUCE_SUM"),
+  std::string("Algorithm_SEGMENTED_SCAN"),
+  std::string("Algorithm_SEGMENTED_REDUCE"),
+
+//
+// Memory kernels...
+//
+  std::string("Memory_POINTER_CHASE"),
+  std::string("Memory_RANDOM_GATHER"),
+  std::string("Memory_STRIDED_READ"),
 
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
@@ -312,6 +333,34 @@ static const std::string FeatureNames [] =
 }; // END FeatureNames
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each input data distribution used in suite.
+ *
+ * IMPORTANT: This is only modified when a new distribution is added to suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF INPUT DISTRIBUTION IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string InputDistributionNames [] =
+{
+
+  std::string("uniform"),
+  std::string("sorted"),
+  std::string("reverse"),
+  std::string("nearly_sorted"),
+  std::string("duplicates"),
+  std::string("zipf"),
+  std::string("all_equal"),
+
+  std::string("Unknown Distribution")  // Keep this at the end and DO NOT remove....
+
+}; // END InputDistributionNames
+
+
 /*
  *******************************************************************************
  *
@@ -488,6 +537,19 @@ const std::string& getFeatureName(FeatureID fid)
   return FeatureNames[fid];
 }
 
+/*
+ *******************************************************************************
+ *
+ * Return input distribution name associated with InputDistributionID enum
+ * value.
+ *
+ *******************************************************************************
+ */
+const std::string& getInputDistributionName(InputDistributionID did)
+{
+  return InputDistributionNames[did];
+}
+
 /*
  *******************************************************************************
  *
@@ -753,6 +815,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::PRESSURE(run_params);
        break;
     }
+    case Apps_SPMV : {
+       kernel = new apps::SPMV(run_params);
+       break;
+    }
     case Apps_VOL3D : {
        kernel = new apps::VOL3D(run_params);
        break;
@@ -777,6 +843,30 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::REDUCE_SUM(run_params);
        break;
     }
+    case Algorithm_SEGMENTED_SCAN: {
+       kernel = new algorithm::SEGMENTED_SCAN(run_params);
+       break;
+    }
+    case Algorithm_SEGMENTED_REDUCE: {
+       kernel = new algorithm::SEGMENTED_REDUCE(run_params);
+       break;
+    }
+
+//
+// Memory kernels...
+//
+    case Memory_POINTER_CHASE: {
+       kernel = new memory::POINTER_CHASE(run_params);
+       break;
+    }
+    case Memory_RANDOM_GATHER: {
+       kernel = new memory::RANDOM_GATHER(run_params);
+       break;
+    }
+    case Memory_STRIDED_READ: {
+       kernel = new memory::STRIDED_READ(run_params);
+       break;
+    }
 
     default: {
       getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
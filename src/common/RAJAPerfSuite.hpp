@@ -46,6 +46,7 @@ enum GroupID {
   Stream,
   Apps,
   Algorithm,
+  Memory,
 
   NumGroups // Keep this one last and DO NOT remove (!!)
 
@@ -144,6 +145,7 @@ enum KernelID {
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
   Apps_PRESSURE,
+  Apps_SPMV,
   Apps_VOL3D,
 
 //
@@ -153,6 +155,15 @@ enum KernelID {
   Algorithm_SORT,
   Algorithm_SORTPAIRS,
   Algorithm_REDUCE_SUM,
+  Algorithm_SEGMENTED_SCAN,
+  Algorithm_SEGMENTED_REDUCE,
+
+//
+// Memory kernels...
+//
+  Memory_POINTER_CHASE,
+  Memory_RANDOM_GATHER,
+  Memory_STRIDED_READ,
 
   NumKernels // Keep this one last and NEVER comment out (!!)
 
@@ -229,6 +240,35 @@ enum FeatureID {
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each input data distribution
+ *        used by kernels whose performance depends on their input values
+ *        (sorts, scans, reductions).
+ *
+ * IMPORTANT: This is only modified when a new distribution is added to suite.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF INPUT DISTRIBUTION NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum InputDistributionID {
+
+  Dist_Uniform = 0,
+  Dist_Sorted,
+  Dist_Reverse,
+  Dist_NearlySorted,
+  Dist_Duplicates,
+  Dist_Zipf,
+  Dist_AllEqual,
+
+  NumInputDistributions // Keep this one last and NEVER comment out (!!)
+
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -298,6 +338,16 @@ bool isVariantGPU(VariantID vid);
  */
 const std::string& getFeatureName(FeatureID vid);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return input distribution name associated with InputDistributionID
+ *        enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getInputDistributionName(InputDistributionID did);
+
 /*!
  *******************************************************************************
  *
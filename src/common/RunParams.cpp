@@ -35,8 +35,20 @@ RunParams::RunParams(int argc, char** argv)
    size(0.0),
    size_factor(0.0),
    gpu_block_sizes(),
+   host_tuning_values(),
+   selectivity(0.5),
+   input_distribution(Dist_Uniform),
+   mean_segment_length(64),
+   segment_lengths(SegmentLengths::Uniform),
+   spmv_matrix(SpmvMatrix::Stencil7pt),
+   pa_order(0),
+   fir_coefflen(0),
+   strided_read_stride(0),
    pf_tol(0.1),
    checkrun_reps(1),
+   autotune(false),
+   retune(false),
+   autotune_cache_file("RAJAPerf-autotune-cache.txt"),
    reference_variant(),
    kernel_input(),
    invalid_kernel_input(),
@@ -102,8 +114,26 @@ void RunParams::print(std::ostream& str) const
   for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
     str << "\n\t" << gpu_block_sizes[j];
   }
+  str << "\n host_tuning_values = ";
+  for (auto const& values : host_tuning_values) {
+    str << "\n\t" << values.first << " =";
+    for (size_t j = 0; j < values.second.size(); ++j) {
+      str << " " << values.second[j];
+    }
+  }
+  str << "\n selectivity = " << selectivity;
+  str << "\n input_distribution = " << getInputDistributionName(input_distribution);
+  str << "\n mean_segment_length = " << mean_segment_length;
+  str << "\n segment_lengths = " << SegmentLengthsToStr(segment_lengths);
+  str << "\n spmv_matrix = " << SpmvMatrixToStr(spmv_matrix);
+  str << "\n pa_order = " << pa_order;
+  str << "\n fir_coefflen = " << fir_coefflen;
+  str << "\n strided_read_stride = " << strided_read_stride;
   str << "\n pf_tol = " << pf_tol;
   str << "\n checkrun_reps = " << checkrun_reps;
+  str << "\n autotune = " << autotune;
+  str << "\n retune = " << retune;
+  str << "\n autotune_cache_file = " << autotune_cache_file;
   str << "\n reference_variant = " << reference_variant;
   str << "\n outdir = " << outdir;
   str << "\n outfile_prefix = " << outfile_prefix;
@@ -167,6 +197,29 @@ void RunParams::print(std::ostream& str) const
 }
 
 
+/*
+ *******************************************************************************
+ *
+ * Return name of host tuning parameter whose values are given by command
+ * line option opt, nullptr if opt does not give host tuning values.
+ *
+ *******************************************************************************
+ */
+static const char* getHostTuningParamName(const std::string& opt)
+{
+  if ( opt == std::string("--host_tile_size") ) {
+    return host_tuning::tile_size::name();
+  } else if ( opt == std::string("--host_unroll") ) {
+    return host_tuning::unroll::name();
+  } else if ( opt == std::string("--host_chunk_size") ) {
+    return host_tuning::chunk_size::name();
+  } else if ( opt == std::string("--prefetch_distance") ) {
+    return host_tuning::prefetch_distance::name();
+  }
+  return nullptr;
+}
+
+
 /*
  *******************************************************************************
  *
@@ -347,6 +400,211 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( getHostTuningParamName(opt) != nullptr ) {
+
+      const std::string host_opt = opt;
+      std::vector<size_t>& values =
+          host_tuning_values[getHostTuningParamName(host_opt)];
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int value = ::atoi( opt.c_str() );
+          if ( value <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give " << host_opt << " POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            values.push_back(value);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give " << host_opt << " one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--selectivity") ) {
+
+      i++;
+      if ( i < argc ) {
+        selectivity = ::atof( argv[i] );
+        if ( selectivity < 0.0 || selectivity > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --selectivity a value in [0, 1] (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --selectivity a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--input-distribution") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string dist_name(argv[i]);
+        input_distribution = NumInputDistributions;
+        for (size_t id = 0; id < NumInputDistributions; ++id) {
+          InputDistributionID did = static_cast<InputDistributionID>(id);
+          if ( getInputDistributionName(did) == dist_name ) {
+            input_distribution = did;
+          }
+        }
+        if ( input_distribution == NumInputDistributions ) {
+          getCout() << "\nBad input:"
+                    << " unknown --input-distribution " << dist_name
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --input-distribution a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--mean-segment-length") ) {
+
+      i++;
+      if ( i < argc ) {
+        int mean_len = ::atoi( argv[i] );
+        if ( mean_len < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --mean-segment-length a value greater than 0 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          mean_segment_length = mean_len;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --mean-segment-length a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--segment-lengths") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string lengths_name(argv[i]);
+        if ( lengths_name == SegmentLengthsToStr(SegmentLengths::Fixed) ) {
+          segment_lengths = SegmentLengths::Fixed;
+        } else if ( lengths_name == SegmentLengthsToStr(SegmentLengths::Uniform) ) {
+          segment_lengths = SegmentLengths::Uniform;
+        } else if ( lengths_name == SegmentLengthsToStr(SegmentLengths::PowerLaw) ) {
+          segment_lengths = SegmentLengths::PowerLaw;
+        } else {
+          getCout() << "\nBad input:"
+                    << " unknown --segment-lengths " << lengths_name
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --segment-lengths a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--spmv-matrix") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string matrix_name(argv[i]);
+        if ( matrix_name == SpmvMatrixToStr(SpmvMatrix::Stencil7pt) ) {
+          spmv_matrix = SpmvMatrix::Stencil7pt;
+        } else if ( matrix_name == SpmvMatrixToStr(SpmvMatrix::Stencil27pt) ) {
+          spmv_matrix = SpmvMatrix::Stencil27pt;
+        } else if ( matrix_name == SpmvMatrixToStr(SpmvMatrix::RandomGraph) ) {
+          spmv_matrix = SpmvMatrix::RandomGraph;
+        } else {
+          getCout() << "\nBad input:"
+                    << " unknown --spmv-matrix " << matrix_name
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --spmv-matrix a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pa-order") ) {
+
+      i++;
+      if ( i < argc ) {
+        int order = ::atoi( argv[i] );
+        if ( order < 1 || order > 8 ) {
+          getCout() << "\nBad input:"
+                    << " must give --pa-order a value from 1 to 8 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          pa_order = order;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --pa-order a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fir-coefflen") ) {
+
+      i++;
+      if ( i < argc ) {
+        int coefflen = ::atoi( argv[i] );
+        if ( coefflen < 1 || coefflen > 4096 ) {
+          getCout() << "\nBad input:"
+                    << " must give --fir-coefflen a value from 1 to 4096 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          fir_coefflen = coefflen;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --fir-coefflen a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--strided-read-stride") ) {
+
+      i++;
+      if ( i < argc ) {
+        int stride = ::atoi( argv[i] );
+        if ( stride < 1 || stride > 1024 ) {
+          getCout() << "\nBad input:"
+                    << " must give --strided-read-stride a value from 1 to 1024 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          strided_read_stride = stride;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --strided-read-stride a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--pass-fail-tol") ||
                 opt == std::string("-pftol") ) {
 
@@ -516,6 +774,29 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
       }
 
+    } else if ( std::string(argv[i]) == std::string("--autotune") ) {
+
+      autotune = true;
+
+    } else if ( std::string(argv[i]) == std::string("--retune") ) {
+
+      autotune = true;
+      retune = true;
+
+    } else if ( std::string(argv[i]) == std::string("--autotune-cache") ) {
+
+      autotune = true;
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+        } else {
+          autotune_cache_file = std::string( argv[i] );
+        }
+      }
+
     } else {
 
       input_state = BadInput;
@@ -597,6 +878,89 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --gpu_block_size 128 256 512 (runs kernels with gpu_block_size 128, 256, and 512)\n\n";
 
+  str << "\t --host_tile_size <space-separated ints> [no default]\n"
+      << "\t      (tile sizes to run for all host kernels with tile size tunings)\n"
+      << "\t      (host kernels not supporting host_tile_size will be skipped)\n"
+      << "\t      (Support is determined by kernel implementation and cmake variable RAJA_PERFSUITE_HOST_TILE_SIZES)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --host_tile_size 16 32 (runs kernels with host_tile_size 16 and 32)\n\n";
+
+  str << "\t --host_unroll <space-separated ints> [no default]\n"
+      << "\t      (unroll factors to run for all host kernels with unroll tunings)\n"
+      << "\t      (unroll tunings with other factors will be skipped)\n"
+      << "\t      (Support is determined by kernel implementation and cmake variable RAJA_PERFSUITE_HOST_UNROLLS)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --host_unroll 4 8 (runs kernels with host_unroll 4 and 8)\n\n";
+
+  str << "\t --host_chunk_size <space-separated ints> [no default]\n"
+      << "\t      (OpenMP schedule chunk sizes to run for all host kernels with chunk tunings)\n"
+      << "\t      (chunk tunings with other sizes will be skipped)\n"
+      << "\t      (Support is determined by kernel implementation and cmake variable RAJA_PERFSUITE_HOST_CHUNK_SIZES)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --host_chunk_size 1 16 (runs kernels with host_chunk_size 1 and 16)\n\n";
+
+  str << "\t --prefetch_distance <space-separated ints> [no default]\n"
+      << "\t      (prefetch distances to run for all host kernels with prefetch tunings)\n"
+      << "\t      (prefetch tunings with other distances will be skipped)\n"
+      << "\t      (Support is determined by kernel implementation and cmake variable RAJA_PERFSUITE_PREFETCH_DISTANCES)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --prefetch_distance 16 64 (runs kernels with prefetch_distance 16 and 64)\n\n";
+
+  str << "\t --selectivity <double> [default is 0.5]\n"
+      << "\t      (fraction of elements selected by stream compaction kernels,\n"
+      << "\t       i.e., INDEXLIST and INDEXLIST_3LOOP)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --selectivity 0.05 (about 5% of elements end up in the index list)\n\n";
+
+  str << "\t --input-distribution <string> [default is uniform]\n"
+      << "\t      (distribution of input values of algorithm kernels,\n"
+      << "\t       i.e., SORT, SORTPAIRS, SCAN, and REDUCE_SUM; one of\n"
+      << "\t      ";
+  for (size_t id = 0; id < NumInputDistributions; ++id) {
+    str << " " << getInputDistributionName(static_cast<InputDistributionID>(id));
+  }
+  str << ")\n";
+  str << "\t\t Example...\n"
+      << "\t\t --input-distribution nearly_sorted (sort input that is sorted except for a few swaps)\n\n";
+
+  str << "\t --mean-segment-length <int> [default is 64]\n"
+      << "\t      (mean number of elements per segment of segmented algorithm\n"
+      << "\t       kernels, i.e., SEGMENTED_SCAN and SEGMENTED_REDUCE)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --mean-segment-length 8 (many short segments)\n\n";
+
+  str << "\t --segment-lengths <string> [default is uniform]\n"
+      << "\t      (distribution of segment lengths of segmented algorithm kernels;\n"
+      << "\t       one of fixed, uniform, power_law)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --segment-lengths power_law (mostly short segments and a few very long ones)\n\n";
+
+  str << "\t --spmv-matrix <string> [default is stencil_7pt]\n"
+      << "\t      (sparse matrix used by SPMV;\n"
+      << "\t       one of stencil_7pt, stencil_27pt, random)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --spmv-matrix random (random columns and varying row lengths)\n\n";
+
+  str << "\t --pa-order <int> [default is each kernel's own order]\n"
+      << "\t      (polynomial order of partial assembly kernels, i.e., MASS3DPA,\n"
+      << "\t       DIFFUSION3DPA, and CONVECTION3DPA; from 1 to 8, order p uses\n"
+      << "\t       p+1 dofs and p+2 quadrature points in 1D; GPU variants only\n"
+      << "\t       run at each kernel's own order)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --pa-order 6 (run the partial assembly kernels at order 6)\n\n";
+
+  str << "\t --fir-coefflen <int> [default is 16]\n"
+      << "\t      (number of filter coefficients of FIR, from 1 to 4096;\n"
+      << "\t       GPU variants only run with the default length)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --fir-coefflen 256 (run FIR with a 256 tap filter)\n\n";
+
+  str << "\t --strided-read-stride <int> [default is 8]\n"
+      << "\t      (stride in elements between the reads of STRIDED_READ,\n"
+      << "\t       from 1 to 1024)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --strided-read-stride 1 (run STRIDED_READ with unit stride)\n\n";
+
   str << "\t --pass-fail-tol, -pftol <double> [default is 0.1; i.e., 10%]\n"
       << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report)\n";
   str << "\t\t Example...\n"
@@ -664,6 +1028,18 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --checkrun 2 (run each kernel twice)\n\n";
 
+  str << "\t --autotune (run only the best tuning of each kernel variant)\n"
+      << "\t      (best tuning is read from the autotune cache file, kernel variants not in the cache\n"
+      << "\t       are searched first and the tuning found is added to the cache)\n"
+      << "\t      (search is exhaustive for a few tunings and successive halving for many)\n\n";
+
+  str << "\t --retune (same as --autotune, but search all kernel variants and replace cached tunings)\n\n";
+
+  str << "\t --autotune-cache <string> [Default is RAJAPerf-autotune-cache.txt]\n"
+      << "\t      (autotune cache file name, relative to the run directory; implies --autotune)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --autotune-cache ~/rajaperf-tunings.txt (share tuning cache between run directories)\n\n";
+
   str << std::endl;
   str.flush();
 }
@@ -674,10 +1050,7 @@ void RunParams::printKernelNames(std::ostream& str) const
   str << "\nAvailable kernels:";
   str << "\n------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -688,10 +1061,7 @@ void RunParams::printFullKernelNames(std::ostream& str) const
   str << "\nAvailable kernels (<group name>_<kernel name>):";
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -737,14 +1107,11 @@ void RunParams::printFeatureKernels(std::ostream& str) const
     str << getFeatureName(tfid) << std::endl;
     for (int kid = 0; kid < NumKernels; ++kid) {
       KernelID tkid = static_cast<KernelID>(kid);
-///   RDH DISABLE COUPLE KERNEL
-      if (tkid != Apps_COUPLE) {
-         KernelBase* kern = getKernelObject(tkid, *this);
-         if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFullKernelName(tkid) << std::endl;
-         }
-         delete kern;
+      KernelBase* kern = getKernelObject(tkid, *this);
+      if ( kern->usesFeature(tfid) ) {
+        str << "\t" << getFullKernelName(tkid) << std::endl;
       }
+      delete kern;
     }  // loop over kernels
     str << std::endl;
   }  // loop over features
@@ -757,18 +1124,15 @@ void RunParams::printKernelFeatures(std::ostream& str) const
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
     KernelID tkid = static_cast<KernelID>(kid);
-/// RDH DISABLE COUPLE KERNEL
-    if (tkid != Apps_COUPLE) {
-      str << getFullKernelName(tkid) << std::endl;
-      KernelBase* kern = getKernelObject(tkid, *this);
-      for (int fid = 0; fid < NumFeatures; ++fid) {
-        FeatureID tfid = static_cast<FeatureID>(fid);
-        if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFeatureName(tfid) << std::endl;
-        }
-      }  // loop over features
-      delete kern;
-    }
+    str << getFullKernelName(tkid) << std::endl;
+    KernelBase* kern = getKernelObject(tkid, *this);
+    for (int fid = 0; fid < NumFeatures; ++fid) {
+      FeatureID tfid = static_cast<FeatureID>(fid);
+      if ( kern->usesFeature(tfid) ) {
+         str << "\t" << getFeatureName(tfid) << std::endl;
+      }
+    }  // loop over features
+    delete kern;
   }  // loop over kernels
   str.flush();
 }
@@ -9,6 +9,7 @@
 #ifndef RAJAPerf_RunParams_HPP
 #define RAJAPerf_RunParams_HPP
 
+#include <map>
 #include <string>
 #include <vector>
 #include <iosfwd>
@@ -91,6 +92,53 @@ public:
     }
   }
 
+  /*!
+   * \brief Enumeration indicating how segment lengths of segmented
+   *        algorithm kernels are distributed
+   */
+  enum SegmentLengths {
+    Fixed,      /*!< every segment has the mean length */
+    Uniform,    /*!< lengths uniform in [0, 2*mean], some segments empty */
+    PowerLaw,   /*!< mostly short segments and a few very long ones */
+  };
+
+  static std::string SegmentLengthsToStr(SegmentLengths sl)
+  {
+    switch (sl) {
+      case SegmentLengths::Fixed:
+        return "fixed";
+      case SegmentLengths::Uniform:
+        return "uniform";
+      case SegmentLengths::PowerLaw:
+        return "power_law";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration indicating which sparse matrix sparse kernels use
+   */
+  enum SpmvMatrix {
+    Stencil7pt,   /*!< 7-point stencil on a 3D grid */
+    Stencil27pt,  /*!< 27-point stencil on a 3D grid */
+    RandomGraph,  /*!< random columns, row lengths vary */
+  };
+
+  static std::string SpmvMatrixToStr(SpmvMatrix sm)
+  {
+    switch (sm) {
+      case SpmvMatrix::Stencil7pt:
+        return "stencil_7pt";
+      case SpmvMatrix::Stencil27pt:
+        return "stencil_27pt";
+      case SpmvMatrix::RandomGraph:
+        return "random";
+      default:
+        return "Unknown";
+    }
+  }
+
 //@{
 //! @name Methods to get/set input state
 
@@ -136,10 +184,47 @@ public:
     return false;
   }
 
+  // true if value is one of the values given for the host tuning parameter
+  // named param_name, or if no values were given for that parameter
+  bool validHostTuningValue(const std::string& param_name, size_t value) const
+  {
+    auto values = host_tuning_values.find(param_name);
+    if (values == host_tuning_values.end()) {
+      return true;
+    }
+    for (size_t valid_value : values->second) {
+      if (valid_value == value) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  double getSelectivity() const { return selectivity; }
+
+  InputDistributionID getInputDistribution() const
+                      { return input_distribution; }
+
+  int getMeanSegmentLength() const { return mean_segment_length; }
+  SegmentLengths getSegmentLengths() const { return segment_lengths; }
+
+  SpmvMatrix getSpmvMatrix() const { return spmv_matrix; }
+
+  int getPAOrder() const { return pa_order; }
+
+  int getFIRCoeffLen() const { return fir_coefflen; }
+
+  int getStridedReadStride() const { return strided_read_stride; }
+
   double getPFTolerance() const { return pf_tol; }
 
   int getCheckRunReps() const { return checkrun_reps; }
 
+  bool getAutotune() const { return autotune; }
+  bool getRetune() const { return retune; }
+  const std::string& getAutotuneCacheFileName() const
+                     { return autotune_cache_file; }
+
   const std::string& getReferenceVariant() const { return reference_variant; }
 
   const std::vector<std::string>& getKernelInput() const
@@ -233,12 +318,36 @@ private:
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
   std::vector<size_t> gpu_block_sizes; /*!< Block sizes for gpu tunings to run (input option) */
+  std::map<std::string, std::vector<size_t>> host_tuning_values; /*!< Values of host tuning
+                              parameters to run, keyed by parameter name (input option) */
+
+  double selectivity;    /*!< fraction of elements selected by stream
+                              compaction kernels (input option) */
+  InputDistributionID input_distribution; /*!< distribution of input values
+                              of algorithm kernels (input option) */
+  int mean_segment_length; /*!< mean segment length of segmented
+                              algorithm kernels (input option) */
+  SegmentLengths segment_lengths; /*!< distribution of segment lengths of
+                              segmented algorithm kernels (input option) */
+  SpmvMatrix spmv_matrix; /*!< sparse matrix used by sparse kernels
+                              (input option) */
+  int pa_order;          /*!< polynomial order of partial assembly kernels,
+                              0 means each kernel's own order (input option) */
+  int fir_coefflen;      /*!< number of filter coefficients of FIR,
+                              0 means the kernel's own length (input option) */
+  int strided_read_stride; /*!< stride in elements of STRIDED_READ,
+                              0 means the kernel's own stride (input option) */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
+  bool autotune;         /*!< true -> run only best tuning of each kernel
+                              variant, searching for it when not cached */
+  bool retune;           /*!< true -> search tunings even if cached */
+  std::string autotune_cache_file; /*!< File holding best tunings found */
+
   std::string reference_variant;   /*!< Name of reference variant for speedup
                                         calculations */
 
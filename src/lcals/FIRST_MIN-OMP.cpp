@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -19,10 +20,18 @@ namespace lcals
 
 FIRST_MIN_MINLOC_COMPARE;
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantTwoPass(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantBlocked(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -111,10 +120,254 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+//
+// Parallel min reduction of the vectorized min value of each block, then
+// parallel min reduction of the first index in each block with that value.
+//
+void FIRST_MIN::runOpenMPVariantTwoPass(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  const Index_type nblocks = RAJA_DIVIDE_CEILING_INT(iend - ibegin, min_block_size);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xmin = m_xmin_init;
+
+        #pragma omp parallel for reduction(min:xmin)
+        for (Index_type b = 0; b < nblocks; ++b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          xmin = first_min_vec_min(x, bbegin, bend, xmin);
+        }
+
+        Index_type loc = iend;
+
+        #pragma omp parallel for reduction(min:loc)
+        for (Index_type b = 0; b < nblocks; ++b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          const Index_type bloc = first_min_find(x, bbegin, bend, xmin);
+          if ( bloc < bend ) {
+            loc = RAJA_MIN(loc, bloc);
+          }
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      const Real_type xmin_init = m_xmin_init;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMin<RAJA::omp_reduce, Real_type> xmin(m_xmin_init);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          xmin.min(first_min_vec_min(x, bbegin, bend, xmin_init));
+        });
+
+        const Real_type xmin_val = xmin.get();
+
+        RAJA::ReduceMin<RAJA::omp_reduce, Index_type> loc(iend);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          const Index_type bloc = first_min_find(x, bbegin, bend, xmin_val);
+          if ( bloc < bend ) {
+            loc.min(bloc);
+          }
+        });
+
+        m_minloc = RAJA_MAX(m_minloc, loc.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread keeps the first block with the smallest value in its
+// contiguous range of blocks, thread partials are combined in thread order
+// and the block found is searched for the first index with that value.
+//
+void FIRST_MIN::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  const Index_type nblocks = RAJA_DIVIDE_CEILING_INT(iend - ibegin, min_block_size);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nthreads = omp_get_max_threads();
+
+      std::vector<Real_type> thread_min(nthreads, m_xmin_init);
+      std::vector<Index_type> thread_bmin(nthreads, -1);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_type xmin = m_xmin_init;
+          Index_type bmin = -1;
+
+          // static schedule gives each thread a contiguous range of blocks
+          // in thread order
+          #pragma omp for schedule(static)
+          for (Index_type b = 0; b < nblocks; ++b) {
+            const Index_type bbegin = ibegin + b * min_block_size;
+            const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+            const Real_type bval = first_min_vec_min(x, bbegin, bend, xmin);
+            if ( bval < xmin ) {
+              xmin = bval;
+              bmin = b;
+            }
+          }
+
+          thread_min[omp_get_thread_num()] = xmin;
+          thread_bmin[omp_get_thread_num()] = bmin;
+        }
+
+        Real_type xmin = m_xmin_init;
+        Index_type bmin = -1;
+        for (Index_type t = 0; t < nthreads; ++t) {
+          if ( thread_bmin[t] >= 0 && thread_min[t] < xmin ) {
+            xmin = thread_min[t];
+            bmin = thread_bmin[t];
+          }
+          thread_bmin[t] = -1;
+        }
+
+        Index_type loc = m_initloc;
+        if ( bmin >= 0 ) {
+          const Index_type bbegin = ibegin + bmin * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          loc = first_min_find(x, bbegin, bend, xmin);
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      Real_ptr block_min;
+      allocAndInitDataConst(block_min, nblocks, 0.0, vid);
+
+      const Real_type xmin_init = m_xmin_init;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMin<RAJA::omp_reduce, Real_type> xmin(m_xmin_init);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          block_min[b] = first_min_vec_min(x, bbegin, bend, xmin_init);
+          xmin.min(block_min[b]);
+        });
+
+        const Real_type xmin_val = xmin.get();
+
+        RAJA::ReduceMin<RAJA::omp_reduce, Index_type> bmin(nblocks);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          if ( block_min[b] == xmin_val ) {
+            bmin.min(b);
+          }
+        });
+
+        const Index_type bbegin = ibegin + bmin.get() * min_block_size;
+        const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+        Index_type loc = first_min_find(x, bbegin, bend, xmin_val);
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      deallocData(block_min);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void FIRST_MIN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "twopass");
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -18,8 +18,16 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantTwoPass(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runSeqVariantBlocked(vid);
+    return;
+  }
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -104,5 +112,190 @@ void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+//
+// Vectorized min value pass, then search for the first index with that value.
+//
+void FIRST_MIN::runSeqVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xmin = first_min_vec_min(x, ibegin, iend, m_xmin_init);
+
+        Index_type loc = first_min_find(x, ibegin, iend, xmin);
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMin<RAJA::seq_reduce, Real_type> xmin(m_xmin_init);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          xmin.min(x[i]);
+        });
+
+        const Real_type xmin_val = xmin.get();
+
+        RAJA::ReduceMin<RAJA::seq_reduce, Index_type> loc(iend);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          if ( x[i] == xmin_val ) {
+            loc.min(i);
+          }
+        });
+
+        m_minloc = RAJA_MAX(m_minloc, loc.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+//
+// Vectorized min value of each block, keep the first block with the
+// smallest value and search it for the first index with that value.
+//
+void FIRST_MIN::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  const Index_type nblocks = RAJA_DIVIDE_CEILING_INT(iend - ibegin, min_block_size);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xmin = m_xmin_init;
+        Index_type bmin = -1;
+
+        for (Index_type b = 0; b < nblocks; ++b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          const Real_type bval = first_min_vec_min(x, bbegin, bend, xmin);
+          if ( bval < xmin ) {
+            xmin = bval;
+            bmin = b;
+          }
+        }
+
+        Index_type loc = m_initloc;
+        if ( bmin >= 0 ) {
+          const Index_type bbegin = ibegin + bmin * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          loc = first_min_find(x, bbegin, bend, xmin);
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      Real_ptr block_min;
+      allocAndInitDataConst(block_min, nblocks, 0.0, vid);
+
+      const Real_type xmin_init = m_xmin_init;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMin<RAJA::seq_reduce, Real_type> xmin(m_xmin_init);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          const Index_type bbegin = ibegin + b * min_block_size;
+          const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+          block_min[b] = first_min_vec_min(x, bbegin, bend, xmin_init);
+          xmin.min(block_min[b]);
+        });
+
+        const Real_type xmin_val = xmin.get();
+
+        RAJA::ReduceMin<RAJA::seq_reduce, Index_type> bmin(nblocks);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+          if ( block_min[b] == xmin_val ) {
+            bmin.min(b);
+          }
+        });
+
+        const Index_type bbegin = ibegin + bmin.get() * min_block_size;
+        const Index_type bend = RAJA_MIN(bbegin + min_block_size, iend);
+        Index_type loc = first_min_find(x, bbegin, bend, xmin_val);
+
+        m_minloc = RAJA_MAX(m_minloc, loc);
+
+      }
+      stopTimer();
+
+      deallocData(block_min);
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIRST_MIN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "twopass");
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -17,6 +17,13 @@
 ///   if ( x[i] < x[loc] ) loc = i;
 /// }
 ///
+/// The "twopass" tunings find the minimum value with a vectorized min
+/// reduction and then the first index holding that value. The "blocked"
+/// tunings find the minimum value of each block of min_block_size values,
+/// keep the first block with the smallest value, and search that block
+/// for the first index. Partial results are combined in index order so
+/// ties resolve to the first index as in the reference implementation.
+///
 
 #ifndef RAJAPerf_Lcals_FIRST_MIN_HPP
 #define RAJAPerf_Lcals_FIRST_MIN_HPP
@@ -64,6 +71,49 @@ class RunParams;
 namespace lcals
 {
 
+//
+// Minimum of xmin and x[ibeg, iend), each lane keeps its own minimum so
+// the compare and select in the inner loop vectorize.
+//
+inline Real_type first_min_vec_min(const Real_type* x,
+                                   Index_type ibeg, Index_type iend,
+                                   Real_type xmin)
+{
+  constexpr Index_type lanes = 8;
+  Real_type lane_min[lanes];
+  for (Index_type l = 0; l < lanes; ++l) {
+    lane_min[l] = xmin;
+  }
+  Index_type i = ibeg;
+  for ( ; i + lanes <= iend; i += lanes) {
+    for (Index_type l = 0; l < lanes; ++l) {
+      lane_min[l] = x[i+l] < lane_min[l] ? x[i+l] : lane_min[l];
+    }
+  }
+  for ( ; i < iend; ++i) {
+    xmin = x[i] < xmin ? x[i] : xmin;
+  }
+  for (Index_type l = 0; l < lanes; ++l) {
+    xmin = lane_min[l] < xmin ? lane_min[l] : xmin;
+  }
+  return xmin;
+}
+
+//
+// First index in [ibeg, iend) with x[i] == xmin, iend if there is none.
+//
+inline Index_type first_min_find(const Real_type* x,
+                                 Index_type ibeg, Index_type iend,
+                                 Real_type xmin)
+{
+  for (Index_type i = ibeg; i < iend; ++i) {
+    if ( x[i] == xmin ) {
+      return i;
+    }
+  }
+  return iend;
+}
+
 class FIRST_MIN : public KernelBase
 {
 public:
@@ -82,6 +132,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantTwoPass(VariantID vid);
+  void runSeqVariantBlocked(VariantID vid);
+  void runOpenMPVariantTwoPass(VariantID vid);
+  void runOpenMPVariantBlocked(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -93,6 +149,9 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // number of values in a block of the "twopass" and "blocked" tunings
+  static const Index_type min_block_size = 2048;
+
   Real_ptr m_x;
   Real_type m_xmin_init;
   Index_type m_initloc;
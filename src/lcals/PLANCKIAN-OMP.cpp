@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/FastMathUtils.hpp"
+
 #include <iostream>
 #include <cmath>
 
@@ -19,10 +21,19 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+#if defined(RP_USE_DOUBLE)
+  if ( getVariantTuningName(vid, tune_idx) == "poly_exp" ) {
+    runOpenMPVariantPolyExp(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -89,6 +100,78 @@ void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RP_USE_DOUBLE)
+void PLANCKIAN::runOpenMPVariantPolyExp(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  auto planckian_lam = [=](Index_type i) {
+                         PLANCKIAN_POLY_EXP_BODY;
+                       };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PLANCKIAN_POLY_EXP_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), planckian_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#endif // RP_USE_DOUBLE
+
+void PLANCKIAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RP_USE_DOUBLE)
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "poly_exp", 1.0e-14);
+  }
 #endif
 }
 
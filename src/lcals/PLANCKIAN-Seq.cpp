@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/FastMathUtils.hpp"
+
 #include <iostream>
 #include <cmath>
 
@@ -19,8 +21,17 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PLANCKIAN::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+#if defined(RP_USE_DOUBLE)
+  if ( getVariantTuningName(vid, tune_idx) == "poly_exp" ) {
+    runSeqVariantPolyExp(vid);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
@@ -87,5 +98,72 @@ void PLANCKIAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+#if defined(RP_USE_DOUBLE)
+void PLANCKIAN::runSeqVariantPolyExp(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  auto planckian_lam = [=](Index_type i) {
+                         PLANCKIAN_POLY_EXP_BODY;
+                       };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PLANCKIAN_POLY_EXP_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), planckian_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#endif // RP_USE_DOUBLE
+
+void PLANCKIAN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+#if defined(RP_USE_DOUBLE)
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "poly_exp", 1.0e-14);
+  }
+#endif
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
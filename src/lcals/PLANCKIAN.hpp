@@ -14,6 +14,10 @@
 ///   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 /// }
 ///
+/// The "poly_exp" tuning replaces exp with the inline polynomial
+/// polyExp from common/FastMathUtils.hpp, it is only defined when
+/// Real_type is double.
+///
 
 #ifndef RAJAPerf_Lcals_PLANCKIAN_HPP
 #define RAJAPerf_Lcals_PLANCKIAN_HPP
@@ -30,6 +34,10 @@
   y[i] = u[i] / v[i]; \
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
+#define PLANCKIAN_POLY_EXP_BODY  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( polyExp( y[i] ) - 1.0 );
+
 
 #include "common/KernelBase.hpp"
 
@@ -58,8 +66,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantPolyExp(VariantID vid);
+  void runOpenMPVariantPolyExp(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
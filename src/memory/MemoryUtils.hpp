@@ -0,0 +1,47 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Helpers used by the memory kernels to build their access patterns.
+///
+
+#ifndef RAJAPerf_Memory_MemoryUtils_HPP
+#define RAJAPerf_Memory_MemoryUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <cstdlib>
+#include <utility>
+
+namespace rajaperf
+{
+namespace memory
+{
+
+//
+// Fill perm with a random permutation of [0, len), same permutation for
+// every run.
+//
+inline void makeRandomPermutation(Int_ptr perm, Index_type len)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    perm[i] = static_cast<Int_type>(i);
+  }
+
+  srand(4793);
+  for (Index_type n = len; n > 1; --n) {
+    Index_type r = static_cast<Index_type>(
+        (static_cast<unsigned long long>(rand()) * RAND_MAX + rand()) % n);
+    std::swap(perm[n-1], perm[r]);
+  }
+}
+
+} // end namespace memory
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "MemoryUtils.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace memory
+{
+
+
+POINTER_CHASE::POINTER_CHASE(const RunParams& params)
+  : KernelBase(rajaperf::Memory_POINTER_CHASE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  m_chain_len = std::max(getTargetProblemSize() / num_chains,
+                         static_cast<Index_type>(1));
+
+  setActualProblemSize( m_chain_len * num_chains );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Int_type) + 0*sizeof(Int_type)) * num_chains +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * num_chains +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+POINTER_CHASE::~POINTER_CHASE()
+{
+}
+
+void POINTER_CHASE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type num_nodes = getActualProblemSize();
+
+  // order[k] is the k-th node of the cycle
+  Int_ptr order;
+  allocData(order, num_nodes);
+  makeRandomPermutation(order, num_nodes);
+
+  allocData(m_next, num_nodes);
+  for (Index_type k = 0; k < num_nodes; ++k) {
+    m_next[order[k]] = order[(k + 1) % num_nodes];
+  }
+
+  allocData(m_chain_start, num_chains);
+  for (Index_type c = 0; c < num_chains; ++c) {
+    m_chain_start[c] = order[c * m_chain_len];
+  }
+
+  deallocData(order);
+
+  allocAndInitData(m_chain_end, num_chains, vid);
+}
+
+void POINTER_CHASE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_chain_end, num_chains);
+}
+
+void POINTER_CHASE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_next);
+  deallocData(m_chain_start);
+  deallocData(m_chain_end);
+}
+
+} // end namespace memory
+} // end namespace rajaperf
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POINTER_CHASE kernel reference implementation:
+///
+/// for (Index_type c = 0; c < num_chains; ++c ) {
+///   Index_type j = chain_start[c];
+///   for (Index_type s = 0; s < chain_len; ++s ) {
+///     j = next[j];
+///   }
+///   chain_end[c] = j;
+/// }
+///
+/// next holds a single cycle through all problem size nodes in random
+/// order, the chains are consecutive pieces of the cycle so each rep
+/// visits every node once. Each load depends on the one before it, so the
+/// time per rep divided by chain_len * num_chains is the load latency of a
+/// working set of problem size * sizeof(Int_type) bytes in the sequential
+/// variants. Run with --size from a few KiB to many times the last level
+/// cache to measure the latency of each level of the memory hierarchy.
+///
+/// The OpenMP variants run the chains in parallel, which measures the
+/// latency seen when every thread is missing in the caches at once.
+///
+
+#ifndef RAJAPerf_Memory_POINTER_CHASE_HPP
+#define RAJAPerf_Memory_POINTER_CHASE_HPP
+
+#define POINTER_CHASE_DATA_SETUP \
+  Int_ptr next = m_next; \
+  Int_ptr chain_start = m_chain_start; \
+  Int_ptr chain_end = m_chain_end; \
+  const Index_type chain_len = m_chain_len;
+
+#define POINTER_CHASE_BODY  \
+  Index_type j = chain_start[c]; \
+  for (Index_type s = 0; s < chain_len; ++s ) { \
+    j = next[j]; \
+  } \
+  chain_end[c] = j;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace memory
+{
+
+class POINTER_CHASE : public KernelBase
+{
+public:
+
+  POINTER_CHASE(const RunParams& params);
+
+  ~POINTER_CHASE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  static const Index_type num_chains = 64;
+
+  Index_type m_chain_len;
+
+  Int_ptr m_next;
+  Int_ptr m_chain_start;
+  Int_ptr m_chain_end;
+};
+
+} // end namespace memory
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RANDOM_GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "MemoryUtils.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace memory
+{
+
+
+RANDOM_GATHER::RANDOM_GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Memory_RANDOM_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type) +
+                   0*sizeof(Int_type) + 1*sizeof(Int_type)) *
+                  getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+RANDOM_GATHER::~RANDOM_GATHER()
+{
+}
+
+void RANDOM_GATHER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+
+  allocData(m_idx, getActualProblemSize());
+  makeRandomPermutation(m_idx, getActualProblemSize());
+}
+
+void RANDOM_GATHER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize());
+}
+
+void RANDOM_GATHER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_idx);
+}
+
+} // end namespace memory
+} // end namespace rajaperf
@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// RANDOM_GATHER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[i] = x[idx[i]];
+/// }
+///
+/// idx is a random permutation of [0, problem size), every element of x is
+/// read once per rep in random order. The loads of x are independent, so
+/// unlike POINTER_CHASE many misses can be in flight at once and the
+/// kernel measures the bandwidth of cache line sized random reads.
+///
+
+#ifndef RAJAPerf_Memory_RANDOM_GATHER_HPP
+#define RAJAPerf_Memory_RANDOM_GATHER_HPP
+
+#define RANDOM_GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define RANDOM_GATHER_BODY  \
+  y[i] = x[idx[i]];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace memory
+{
+
+class RANDOM_GATHER : public KernelBase
+{
+public:
+
+  RANDOM_GATHER(const RunParams& params);
+
+  ~RANDOM_GATHER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  RANDOM_GATHER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  RANDOM_GATHER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  RANDOM_GATHER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+};
+
+} // end namespace memory
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
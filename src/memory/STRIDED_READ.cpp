@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STRIDED_READ.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace rajaperf
+{
+namespace memory
+{
+
+
+STRIDED_READ::STRIDED_READ(const RunParams& params)
+  : KernelBase(rajaperf::Memory_STRIDED_READ, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  m_stride = ( params.getStridedReadStride() > 0 ) ?
+             params.getStridedReadStride() : default_stride;
+
+  // x is allocated with an int length
+  const Index_type max_size = std::numeric_limits<int>::max() / m_stride;
+
+  setActualProblemSize( std::min(getTargetProblemSize(), max_size) );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // each read moves the part of a cache line the stride covers
+  const Index_type bytes_per_read =
+      std::min(m_stride * static_cast<Index_type>(sizeof(Real_type)),
+               static_cast<Index_type>(RAJA::DATA_ALIGN));
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
+                  (0*sizeof(Real_type) + 1*bytes_per_read) *
+                  getActualProblemSize() );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature( Forall );
+  setUsesFeature( Reduction );
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+STRIDED_READ::~STRIDED_READ()
+{
+}
+
+void STRIDED_READ::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, getActualProblemSize() * m_stride, vid);
+
+  m_sum = 0.0;
+  m_sum_init = 0.0;
+}
+
+void STRIDED_READ::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += m_sum;
+}
+
+void STRIDED_READ::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+}
+
+} // end namespace memory
+} // end namespace rajaperf
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// STRIDED_READ kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   sum += x[i * stride];
+/// }
+///
+/// The stride is set with --strided-read-stride, x holds problem size *
+/// stride elements. Bytes per rep count the memory traffic of each read,
+/// min(stride * sizeof(Real_type), cache line size) with RAJA::DATA_ALIGN
+/// as the line size, so with the default stride of 8 each read counts a
+/// whole 64 byte line. Once the stride covers a line the bandwidth stays
+/// flat while the hardware prefetchers keep up. Stride 1 is a unit stride
+/// read for comparison.
+///
+
+#ifndef RAJAPerf_Memory_STRIDED_READ_HPP
+#define RAJAPerf_Memory_STRIDED_READ_HPP
+
+#define STRIDED_READ_DATA_SETUP \
+  Real_ptr x = m_x; \
+  const Index_type stride = m_stride;
+
+#define STRIDED_READ_BODY  \
+  sum += x[i * stride];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace memory
+{
+
+class STRIDED_READ : public KernelBase
+{
+public:
+
+  STRIDED_READ(const RunParams& params);
+
+  ~STRIDED_READ();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  STRIDED_READ : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  STRIDED_READ : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  STRIDED_READ : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  static const Index_type default_stride = 8;
+
+  Index_type m_stride;
+
+  Real_ptr m_x;
+  Real_type m_sum;
+  Real_type m_sum_init;
+};
+
+} // end namespace memory
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/MixedPrecisionDataUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,10 +21,18 @@ namespace polybench
 {
 
 
-void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantStorage<float>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantStorage<BFloat16>(vid);
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_ATAX_DATA_SETUP;
@@ -188,8 +198,151 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < typename StorageT >
+void POLYBENCH_ATAX::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP_STORAGE(StorageT);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_ATAX_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY2;
+          }
+          POLYBENCH_ATAX_BODY3;
+        }
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_ATAX_BODY4;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY5;
+          }
+          POLYBENCH_ATAX_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_ATAX_VIEWS_RAJA_STORAGE(StorageT);
+
+      auto poly_atax_lam1 = [=] (Index_type i, Real_type &dot) {
+                              POLYBENCH_ATAX_BODY1_RAJA;
+                             };
+      auto poly_atax_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+                              POLYBENCH_ATAX_BODY2_RAJA;
+                             };
+      auto poly_atax_lam3 = [=] (Index_type i, Real_type &dot) {
+                              POLYBENCH_ATAX_BODY3_RAJA;
+                             };
+      auto poly_atax_lam4 = [=] (Index_type j, Real_type &dot) {
+                              POLYBENCH_ATAX_BODY4_RAJA;
+                             };
+      auto poly_atax_lam5 = [=] (Index_type i, Index_type j , Real_type &dot) {
+                              POLYBENCH_ATAX_BODY5_RAJA;
+                             };
+      auto poly_atax_lam6 = [=] (Index_type j, Real_type &dot) {
+                              POLYBENCH_ATAX_BODY6_RAJA;
+                             };
+      using EXEC_POL1 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Lambda<0, RAJA::Segs<0>, RAJA::Params<0>>,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
+            >,
+            RAJA::statement::Lambda<2, RAJA::Segs<0>, RAJA::Params<0>>
+          >
+        >;
+
+      using EXEC_POL2 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Lambda<0, RAJA::Segs<1>, RAJA::Params<0>>,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
+            >,
+            RAJA::statement::Lambda<2, RAJA::Segs<1>, RAJA::Params<0>>
+          >
+        >;
+
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel_param<EXEC_POL1>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                           RAJA::RangeSegment{0, N}),
+          RAJA::tuple<Real_type>{0.0},
+
+          poly_atax_lam1,
+          poly_atax_lam2,
+          poly_atax_lam3
+
+        );
+
+        RAJA::kernel_param<EXEC_POL2>(
+          RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                           RAJA::RangeSegment{0, N}),
+          RAJA::tuple<Real_type>{0.0},
+
+          poly_atax_lam4,
+          poly_atax_lam5,
+          poly_atax_lam6
+
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  POLYBENCH_ATAX_DATA_TEARDOWN_STORAGE;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ATAX::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "float",
+                         getStorageChecksumTolerance<float>());
+    addVariantTuningName(vid, "bfloat16",
+                         getStorageChecksumTolerance<BFloat16>());
+    setStorageBytesPerRep(vid);
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 
 namespace rajaperf
@@ -71,6 +72,23 @@ POLYBENCH_ATAX::~POLYBENCH_ATAX()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the x and A arrays are kept in the
+// storage type.
+//
+void POLYBENCH_ATAX::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (2*sizeof(Real_type ) + 1*storage_size) * m_N +
+        (0*storage_size + 1*storage_size) * m_N * m_N +
+        (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N +
+        (0*storage_size + 1*storage_size) * m_N * m_N );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void POLYBENCH_ATAX::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
@@ -87,6 +87,34 @@
   VIEW_1 yview(y, RAJA::Layout<1>(N)); \
   VIEW_2 Aview(A, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_ATAX_DATA_SETUP_STORAGE(StorageT) \
+  Real_ptr tmp = m_tmp; \
+  Real_ptr y = m_y; \
+  StorageT* x; \
+  StorageT* A; \
+  const Index_type N = m_N; \
+  allocAndInitStorageData(x, m_x, N, vid); \
+  allocAndInitStorageData(A, m_A, N*N, vid);
+
+#define POLYBENCH_ATAX_DATA_TEARDOWN_STORAGE \
+  deallocStorageData(x); \
+  deallocStorageData(A);
+
+#define POLYBENCH_ATAX_VIEWS_RAJA_STORAGE(StorageT) \
+  using VIEW_1 = RAJA::View<Real_type, \
+                            RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_1_STORAGE = RAJA::View<StorageT, \
+                                    RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_2_STORAGE = RAJA::View<StorageT, \
+                                    RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_1 tmpview(tmp, RAJA::Layout<1>(N)); \
+  VIEW_1_STORAGE xview(x, RAJA::Layout<1>(N)); \
+  VIEW_1 yview(y, RAJA::Layout<1>(N)); \
+  VIEW_2_STORAGE Aview(A, RAJA::Layout<2>(N, N));
+
 
 #include "common/KernelBase.hpp"
 
@@ -116,8 +144,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -127,6 +161,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Index_type m_N;
   Real_ptr m_tmp;
   Real_ptr m_y;
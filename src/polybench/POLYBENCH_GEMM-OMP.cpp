@@ -19,10 +19,22 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( host_tuning::run_tuning<host_tuning::tile_size, host_tile_sizes_type>(
+         tuning_name,
+         [&](auto tile_size) { runOpenMPVariantTiled<tile_size>(vid); }) ) {
+    return;
+  } else if ( host_tuning::run_tuning<host_tuning::chunk_size, host_chunk_sizes_type>(
+                tuning_name,
+                [&](auto chunk_size) { runOpenMPVariantChunked<chunk_size>(vid); }) ) {
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GEMM_DATA_SETUP;
@@ -148,10 +160,108 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
   }
 
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+template < size_t tile_size_ >
+void POLYBENCH_GEMM::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  constexpr Index_type tile_size = tile_size_;
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            POLYBENCH_GEMM_TILE_BODY(tile_size);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t chunk_size >
+void POLYBENCH_GEMM::runOpenMPVariantChunked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2) schedule(static, chunk_size)
+        for (Index_type i = 0; i < ni; ++i ) {
+          for (Index_type j = 0; j < nj; ++j ) {
+            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY2;
+            for (Index_type k = 0; k < nk; ++k ) {
+              POLYBENCH_GEMM_BODY3;
+            }
+            POLYBENCH_GEMM_BODY4;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
   RAJA_UNUSED_VAR(vid);
 #endif
 }
 
+void POLYBENCH_GEMM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantHostTuningNames<host_tuning::tile_size, host_tile_sizes_type>(vid);
+    addVariantHostTuningNames<host_tuning::chunk_size, host_chunk_sizes_type>(vid);
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
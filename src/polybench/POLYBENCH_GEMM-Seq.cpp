@@ -19,8 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( host_tuning::run_tuning<host_tuning::tile_size, host_tile_sizes_type>(
+         getVariantTuningName(vid, tune_idx),
+         [&](auto tile_size) { runSeqVariantTiled<tile_size>(vid); }) ) {
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GEMM_DATA_SETUP;
@@ -149,5 +155,50 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+template < size_t tile_size_ >
+void POLYBENCH_GEMM::runSeqVariantTiled(VariantID vid)
+{
+  constexpr Index_type tile_size = tile_size_;
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            POLYBENCH_GEMM_TILE_BODY(tile_size);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_GEMM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq ) {
+    addVariantHostTuningNames<host_tuning::tile_size, host_tile_sizes_type>(vid);
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
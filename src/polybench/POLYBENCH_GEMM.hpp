@@ -19,6 +19,11 @@
 ///     C[i][j] = dot;
 ///   }
 /// }
+///
+/// The "tile_<N>" tunings of the Base host variants compute C in N x N
+/// tiles so the rows of B used by a tile are reused by all of its rows of
+/// C. The "chunk_<N>" tunings of Base_OpenMP hand out the (i, j) loop
+/// iterations in chunks of N with a static schedule.
 
 
 #ifndef RAJAPerf_POLYBENCH_GEMM_HPP
@@ -50,6 +55,23 @@
   C[j + i*nj] = dot;
 
 
+// tile of C with rows it to it+tile_size-1 and columns jt to jt+tile_size-1,
+// the sums over k are done in the same order as in the untiled loops
+#define POLYBENCH_GEMM_TILE_BODY(tile_size) \
+  const Index_type iend = std::min(it + tile_size, ni); \
+  const Index_type jend = std::min(jt + tile_size, nj); \
+  for (Index_type i = it; i < iend; ++i ) { \
+    for (Index_type j = jt; j < jend; ++j ) { \
+      POLYBENCH_GEMM_BODY1; \
+      POLYBENCH_GEMM_BODY2; \
+      for (Index_type k = 0; k < nk; ++k ) { \
+        POLYBENCH_GEMM_BODY3; \
+      } \
+      POLYBENCH_GEMM_BODY4; \
+    } \
+  }
+
+
 #define POLYBENCH_GEMM_BODY1_RAJA \
   dot = 0.0;
 
@@ -74,6 +96,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <algorithm>
+
 namespace rajaperf
 {
 
@@ -100,8 +124,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  template < size_t chunk_size >
+  void runOpenMPVariantChunked(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -111,6 +143,10 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using host_tile_sizes_type = host_tuning::make_list_type<host_tuning::tile_size,
+                                                           host_tuning::list_type<16, 32, 64>>;
+  using host_chunk_sizes_type = host_tuning::make_list_type<host_tuning::chunk_size,
+                                                            host_tuning::list_type<1, 16, 256>>;
 
   Index_type m_ni;
   Index_type m_nj;
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/MixedPrecisionDataUtils.hpp"
+
 #include <iostream>
 
 
@@ -18,8 +20,16 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t tune_idx)
 {
+  if ( tune_idx == 1 ) {
+    runSeqVariantStorage<float>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runSeqVariantStorage<BFloat16>(vid);
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_GESUMMV_DATA_SETUP;
@@ -131,5 +141,106 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+template < typename StorageT >
+void POLYBENCH_GESUMMV::runSeqVariantStorage(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GESUMMV_DATA_SETUP_STORAGE(StorageT);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_GESUMMV_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_GESUMMV_BODY2;
+          }
+          POLYBENCH_GESUMMV_BODY3;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      POLYBENCH_GESUMMV_VIEWS_RAJA_STORAGE(StorageT);
+
+      auto poly_gesummv_lam1 = [=](Real_type& tmpdot, Real_type& ydot) {
+                                   POLYBENCH_GESUMMV_BODY1_RAJA;
+                                  };
+      auto poly_gesummv_lam2 = [=](Index_type i, Index_type j,
+                                   Real_type& tmpdot, Real_type& ydot) {
+                                   POLYBENCH_GESUMMV_BODY2_RAJA;
+                                  };
+      auto poly_gesummv_lam3 = [=](Index_type i,
+                                   Real_type& tmpdot, Real_type& ydot) {
+                                   POLYBENCH_GESUMMV_BODY3_RAJA;
+                                  };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,         // i
+            RAJA::statement::Lambda<0, RAJA::Params<0,1>>,
+            RAJA::statement::For<1, RAJA::loop_exec,       // j
+              RAJA::statement::Lambda<1, RAJA::Segs<0, 1>, RAJA::Params<0,1>>
+            >,
+            RAJA::statement::Lambda<2, RAJA::Segs<0>, RAJA::Params<0,1>>
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                            RAJA::RangeSegment{0, N} ),
+          RAJA::make_tuple(static_cast<Real_type>(0.0),
+                           static_cast<Real_type>(0.0)),
+
+          poly_gesummv_lam1,
+          poly_gesummv_lam2,
+          poly_gesummv_lam3
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  POLYBENCH_GESUMMV_DATA_TEARDOWN_STORAGE;
+
+}
+
+void POLYBENCH_GESUMMV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == RAJA_Seq ) {
+    addVariantTuningName(vid, "float",
+                         getStorageChecksumTolerance<float>());
+    addVariantTuningName(vid, "bfloat16",
+                         getStorageChecksumTolerance<BFloat16>());
+    setStorageBytesPerRep(vid);
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
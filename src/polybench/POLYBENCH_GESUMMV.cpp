@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 
 namespace rajaperf
@@ -65,6 +66,21 @@ POLYBENCH_GESUMMV::~POLYBENCH_GESUMMV()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the x, A and B arrays are kept in the
+// storage type.
+//
+void POLYBENCH_GESUMMV::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (2*sizeof(Real_type ) + 1*storage_size) * m_N +
+        (0*storage_size + 2*storage_size) * m_N * m_N );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void POLYBENCH_GESUMMV::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
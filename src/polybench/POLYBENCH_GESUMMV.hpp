@@ -70,6 +70,38 @@
   VIEW2_TYPE Aview(A, RAJA::Layout<2>(N, N)); \
   VIEW2_TYPE Bview(B, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_GESUMMV_DATA_SETUP_STORAGE(StorageT) \
+  const Index_type N = m_N; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  StorageT* x; \
+  Real_ptr y = m_y; \
+  StorageT* A; \
+  StorageT* B; \
+  allocAndInitStorageData(x, m_x, N, vid); \
+  allocAndInitStorageData(A, m_A, N*N, vid); \
+  allocAndInitStorageData(B, m_B, N*N, vid);
+
+#define POLYBENCH_GESUMMV_DATA_TEARDOWN_STORAGE \
+  deallocStorageData(x); \
+  deallocStorageData(A); \
+  deallocStorageData(B);
+
+#define POLYBENCH_GESUMMV_VIEWS_RAJA_STORAGE(StorageT) \
+  using VIEW1_TYPE = RAJA::View<Real_type, \
+                                 RAJA::Layout<1, Index_type, 0>>; \
+  using VIEW1_STORAGE_TYPE = RAJA::View<StorageT, \
+                                         RAJA::Layout<1, Index_type, 0>>; \
+  using VIEW2_STORAGE_TYPE = RAJA::View<StorageT, \
+                                         RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW1_STORAGE_TYPE xview(x, RAJA::Layout<1>(N)); \
+  VIEW1_TYPE yview(y, RAJA::Layout<1>(N)); \
+  VIEW2_STORAGE_TYPE Aview(A, RAJA::Layout<2>(N, N)); \
+  VIEW2_STORAGE_TYPE Bview(B, RAJA::Layout<2>(N, N));
+
 
 #include "common/KernelBase.hpp"
 
@@ -99,8 +131,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -110,6 +148,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Index_type m_N;
 
   Real_type m_alpha;
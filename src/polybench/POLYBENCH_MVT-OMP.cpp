@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/MixedPrecisionDataUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,10 +21,18 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+  if ( tune_idx == 1 ) {
+    runOpenMPVariantStorage<float>(vid);
+    return;
+  } else if ( tune_idx == 2 ) {
+    runOpenMPVariantStorage<BFloat16>(vid);
+    return;
+  }
+
   const Index_type run_reps= getRunReps();
 
   POLYBENCH_MVT_DATA_SETUP;
@@ -191,8 +201,149 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
 #endif
 }
 
+template < typename StorageT >
+void POLYBENCH_MVT::runOpenMPVariantStorage(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP_STORAGE(StorageT);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_MVT_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY2;
+            }
+            POLYBENCH_MVT_BODY3;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_MVT_BODY4;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY5;
+            }
+            POLYBENCH_MVT_BODY6;
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_MVT_VIEWS_RAJA_STORAGE(StorageT);
+
+      auto poly_mvt_lam1 = [=] (Real_type &dot) {
+                                POLYBENCH_MVT_BODY1_RAJA;
+                               };
+      auto poly_mvt_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+                                POLYBENCH_MVT_BODY2_RAJA;
+                               };
+      auto poly_mvt_lam3 = [=] (Index_type i, Real_type &dot) {
+                                POLYBENCH_MVT_BODY3_RAJA;
+                               };
+      auto poly_mvt_lam4 = [=] (Real_type &dot) {
+                                POLYBENCH_MVT_BODY4_RAJA;
+                               };
+      auto poly_mvt_lam5 = [=] (Index_type i, Index_type j, Real_type &dot) {
+                                POLYBENCH_MVT_BODY5_RAJA;
+                               };
+      auto poly_mvt_lam6 = [=] (Index_type i, Real_type &dot) {
+                                POLYBENCH_MVT_BODY6_RAJA;
+                               };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_for_nowait_static_exec< >, // i
+            RAJA::statement::Lambda<0, RAJA::Params<0>>,
+            RAJA::statement::For<1, RAJA::loop_exec,                   // j
+              RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
+            >,
+            RAJA::statement::Lambda<2, RAJA::Segs<0>, RAJA::Params<0>>
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::kernel_param<EXEC_POL>(
+            RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                             RAJA::RangeSegment{0, N}),
+            RAJA::tuple<Real_type>{0.0},
+
+            poly_mvt_lam1,
+            poly_mvt_lam2,
+            poly_mvt_lam3
+
+          );
+
+          RAJA::kernel_param<EXEC_POL>(
+            RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                             RAJA::RangeSegment{0, N}),
+            RAJA::tuple<Real_type>{0.0},
+
+            poly_mvt_lam4,
+            poly_mvt_lam5,
+            poly_mvt_lam6
+
+          );
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  POLYBENCH_MVT_DATA_TEARDOWN_STORAGE;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_MVT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == RAJA_OpenMP ) {
+    addVariantTuningName(vid, "float",
+                         getStorageChecksumTolerance<float>());
+    addVariantTuningName(vid, "bfloat16",
+                         getStorageChecksumTolerance<BFloat16>());
+    setStorageBytesPerRep(vid);
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -84,6 +84,38 @@
   VIEW_1 y2view(y2, RAJA::Layout<1>(N)); \
   VIEW_2 Aview(A, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_MVT_DATA_SETUP_STORAGE(StorageT) \
+  Real_ptr x1 = m_x1; \
+  Real_ptr x2 = m_x2; \
+  StorageT* y1; \
+  StorageT* y2; \
+  StorageT* A; \
+  const Index_type N = m_N; \
+  allocAndInitStorageData(y1, m_y1, N, vid); \
+  allocAndInitStorageData(y2, m_y2, N, vid); \
+  allocAndInitStorageData(A, m_A, N*N, vid);
+
+#define POLYBENCH_MVT_DATA_TEARDOWN_STORAGE \
+  deallocStorageData(y1); \
+  deallocStorageData(y2); \
+  deallocStorageData(A);
+
+#define POLYBENCH_MVT_VIEWS_RAJA_STORAGE(StorageT) \
+  using VIEW_1 = RAJA::View<Real_type, \
+                            RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_1_STORAGE = RAJA::View<StorageT, \
+                                    RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_2_STORAGE = RAJA::View<StorageT, \
+                                    RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_1 x1view(x1, RAJA::Layout<1>(N)); \
+  VIEW_1 x2view(x2, RAJA::Layout<1>(N)); \
+  VIEW_1_STORAGE y1view(y1, RAJA::Layout<1>(N)); \
+  VIEW_1_STORAGE y2view(y2, RAJA::Layout<1>(N)); \
+  VIEW_2_STORAGE Aview(A, RAJA::Layout<2>(N, N));
+
 
 #include "common/KernelBase.hpp"
 
@@ -113,8 +145,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -124,6 +162,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Index_type m_N;
   Real_ptr m_x1;
   Real_ptr m_x2;
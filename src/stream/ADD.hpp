@@ -13,6 +13,9 @@
 ///   c[i] = a[i] + b[i];
 /// }
 ///
+/// The "nontemporal" tuning writes c with streaming (non-temporal) stores
+/// so its cache lines are not read before they are written.
+///
 
 #ifndef RAJAPerf_Stream_ADD_HPP
 #define RAJAPerf_Stream_ADD_HPP
@@ -25,6 +28,23 @@
 #define ADD_BODY  \
   c[i] = a[i] + b[i];
 
+#define ADD_NONTEMPORAL_BODY  \
+  streaming_store::store(&c[i], a[i] + b[i]);
+
+#define ADD_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* a; \
+  StorageT* b; \
+  StorageT* c; \
+  allocAndInitStorageData(a, m_a, iend, vid); \
+  allocAndInitStorageData(b, m_b, iend, vid); \
+  allocAndInitStorageData(c, m_c, iend, vid);
+
+#define ADD_DATA_TEARDOWN_STORAGE \
+  getStorageData(m_c, c, iend); \
+  deallocStorageData(a); \
+  deallocStorageData(b); \
+  deallocStorageData(c);
+
 
 #include "common/KernelBase.hpp"
 
@@ -53,8 +73,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
+  void runSeqVariantNontemporal(VariantID vid);
+  void runOpenMPVariantNontemporal(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -64,6 +92,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_a;
   Real_ptr m_b;
   Real_ptr m_c;
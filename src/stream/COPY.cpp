@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 namespace rajaperf
 {
@@ -30,6 +31,7 @@ COPY::COPY(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setBytesWriteAllocatePerRep( 1*sizeof(Real_type) * getActualProblemSize() );
   setFLOPsPerRep(0);
 
   setUsesFeature( Forall );
@@ -58,6 +60,22 @@ COPY::~COPY()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the a and c arrays are kept in the
+// storage type.
+//
+void COPY::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (1*storage_size + 1*storage_size) * getActualProblemSize() );
+    setVariantTuningBytesWriteAllocatePerRep(vid, name,
+        1*storage_size * getActualProblemSize() );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void COPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitData(m_a, getActualProblemSize(), vid);
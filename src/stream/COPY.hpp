@@ -13,6 +13,9 @@
 ///   c[i] = a[i] ;
 /// }
 ///
+/// The "nontemporal" tuning writes c with streaming (non-temporal) stores
+/// so its cache lines are not read before they are written.
+///
 
 #ifndef RAJAPerf_Stream_COPY_HPP
 #define RAJAPerf_Stream_COPY_HPP
@@ -24,6 +27,20 @@
 #define COPY_BODY  \
   c[i] = a[i] ;
 
+#define COPY_NONTEMPORAL_BODY  \
+  streaming_store::store(&c[i], a[i]);
+
+#define COPY_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* a; \
+  StorageT* c; \
+  allocAndInitStorageData(a, m_a, iend, vid); \
+  allocAndInitStorageData(c, m_c, iend, vid);
+
+#define COPY_DATA_TEARDOWN_STORAGE \
+  getStorageData(m_c, c, iend); \
+  deallocStorageData(a); \
+  deallocStorageData(c);
+
 
 #include "common/KernelBase.hpp"
 
@@ -52,8 +69,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
+  void runSeqVariantNontemporal(VariantID vid);
+  void runOpenMPVariantNontemporal(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -63,6 +88,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_a;
   Real_ptr m_c;
 };
@@ -24,6 +24,16 @@
 #define DOT_BODY  \
   dot += a[i] * b[i] ;
 
+#define DOT_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* a; \
+  StorageT* b; \
+  allocAndInitStorageData(a, m_a, iend, vid); \
+  allocAndInitStorageData(b, m_b, iend, vid);
+
+#define DOT_DATA_TEARDOWN_STORAGE \
+  deallocStorageData(a); \
+  deallocStorageData(b);
+
 
 #include "common/KernelBase.hpp"
 
@@ -52,8 +62,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -63,6 +79,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_a;
   Real_ptr m_b;
   Real_type m_dot;
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+#include "common/MixedPrecisionDataUtils.hpp"
 
 namespace rajaperf
 {
@@ -30,6 +31,7 @@ TRIAD::TRIAD(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setBytesWriteAllocatePerRep( 1*sizeof(Real_type) * getActualProblemSize() );
   setFLOPsPerRep(2 * getActualProblemSize());
 
   checksum_scale_factor = 0.001 *
@@ -62,6 +64,22 @@ TRIAD::~TRIAD()
 {
 }
 
+//
+// Bytes per rep of the storage tunings, the a, b and c arrays are kept in the
+// storage type.
+//
+void TRIAD::setStorageBytesPerRep(VariantID vid)
+{
+  auto set_bytes = [&](std::string const& name, size_t storage_size) {
+    setVariantTuningBytesPerRep(vid, name,
+        (1*storage_size + 2*storage_size) * getActualProblemSize() );
+    setVariantTuningBytesWriteAllocatePerRep(vid, name,
+        1*storage_size * getActualProblemSize() );
+  };
+  set_bytes("float", sizeof(float));
+  set_bytes("bfloat16", sizeof(BFloat16));
+}
+
 void TRIAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
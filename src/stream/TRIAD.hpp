@@ -13,6 +13,9 @@
 ///   a[i] = b[i] + alpha * c[i] ;
 /// }
 ///
+/// The "nontemporal" tuning writes a with streaming (non-temporal) stores
+/// so its cache lines are not read before they are written.
+///
 
 #ifndef RAJAPerf_Stream_TRIAD_HPP
 #define RAJAPerf_Stream_TRIAD_HPP
@@ -26,6 +29,24 @@
 #define TRIAD_BODY  \
   a[i] = b[i] + alpha * c[i] ;
 
+#define TRIAD_NONTEMPORAL_BODY  \
+  streaming_store::store(&a[i], b[i] + alpha * c[i]);
+
+#define TRIAD_DATA_SETUP_STORAGE(StorageT) \
+  StorageT* a; \
+  StorageT* b; \
+  StorageT* c; \
+  Real_type alpha = m_alpha; \
+  allocAndInitStorageData(a, m_a, iend, vid); \
+  allocAndInitStorageData(b, m_b, iend, vid); \
+  allocAndInitStorageData(c, m_c, iend, vid);
+
+#define TRIAD_DATA_TEARDOWN_STORAGE \
+  getStorageData(m_a, a, iend); \
+  deallocStorageData(a); \
+  deallocStorageData(b); \
+  deallocStorageData(c);
+
 
 #include "common/KernelBase.hpp"
 
@@ -54,8 +75,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename StorageT >
+  void runSeqVariantStorage(VariantID vid);
+  template < typename StorageT >
+  void runOpenMPVariantStorage(VariantID vid);
+  void runSeqVariantNontemporal(VariantID vid);
+  void runOpenMPVariantNontemporal(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -65,6 +94,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void setStorageBytesPerRep(VariantID vid);
+
   Real_ptr m_a;
   Real_ptr m_b;
   Real_ptr m_c;
@@ -115,6 +115,13 @@ TEST(ShortSuiteTest, Basic)
           rajaperf::Checksum_type cksum = kernel->getChecksum(vid, tune_idx); 
           rajaperf::Checksum_type cksum_diff = std::abs(cksum_ref - cksum);
 
+          // Reduced precision tunings are checked relative to reference
+          rajaperf::Checksum_type cksum_tol = 1e-7;
+          if ( kernel->getChecksumTolerance(vid, tune_idx) > 0.0 ) {
+            cksum_tol = kernel->getChecksumTolerance(vid, tune_idx) *
+                        std::abs(cksum_ref);
+          }
+
           // Print kernel information when running test manually
           std::cout << "Check kernel, variant, tuning : "
                     << kernel->getName() << " , "
@@ -122,7 +129,7 @@ TEST(ShortSuiteTest, Basic)
                     << kernel->getVariantTuningName(vid, tune_idx) 
                     << std::endl;
           EXPECT_GT(rtime, 0.0);
-          EXPECT_LT(cksum_diff, 1e-7);
+          EXPECT_LT(cksum_diff, cksum_tol);
           
         }
       } 